@@ -33,6 +33,8 @@
  * clist_remove()       | O(n)    | remove and return node
  * clist_sort()         | O(NlogN)| sort list (stable)
  * clist_count()        | O(n)    | count the number of elements in a list
+ * clist_exactly_one()  | O(1)    | true if the list has exactly one element
+ * clist_more_than_one()| O(1)    | true if the list has more than one element
  *
  * clist can be used as a traditional list, a queue (FIFO) and a stack (LIFO) using
  * fast O(1) operations.
@@ -87,6 +89,7 @@
 #ifndef CLIST_H
 #define CLIST_H
 
+#include <stdbool.h>
 #include <stddef.h>
 #include "list.h"
 
@@ -450,6 +453,36 @@ static inline size_t clist_count(clist_node_t *list)
     return cnt;
 }
 
+/**
+ * @brief   Tells if a list has exactly one element
+ *
+ * @note    Complexity: O(1)
+ *
+ * @param[in]   list    Pointer to the clist
+ *
+ * @retval      true    If list has exactly one element
+ * @retval      false   Otherwise
+ */
+static inline bool clist_exactly_one(clist_node_t *list)
+{
+    return list->next && (list->next == list->next->next);
+}
+
+/**
+ * @brief   Tells if a list has more than one element
+ *
+ * @note    Complexity: O(1)
+ *
+ * @param[in]   list    Pointer to the clist
+ *
+ * @retval      true    If list has more than one element
+ * @retval      false   Otherwise
+ */
+static inline bool clist_more_than_one(clist_node_t *list)
+{
+    return list->next && (list->next != list->next->next);
+}
+
 #ifdef __cplusplus
 }
 #endif
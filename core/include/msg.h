@@ -147,6 +147,18 @@
  * }
  * ~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * Blocked senders
+ * ===============
+ * Threads that block in @ref msg_send() because the receiver is neither
+ * receive-blocked nor has free space in its message queue are woken up in
+ * order of priority, threads of equal priority in the order they blocked.
+ * By default, the blocked senders are kept in a single sorted list, so
+ * blocking costs O(n) in the number of threads already waiting on the same
+ * receiver. If many threads send to the same busy receiver, use the
+ * `core_msg_waiters_bitcache` module: it keeps one FIFO per priority level
+ * and a bitmap of non-empty levels, making both blocking and waking up a
+ * sender O(1) at the cost of `SCHED_PRIO_LEVELS` pointers per thread.
+ *
  * Timing & messages
  * =================
  * Timing out the reception of a message or sending messages at a certain time
@@ -232,6 +244,30 @@ int msg_send(msg_t *m, kernel_pid_t target_pid);
 int msg_try_send(msg_t *m, kernel_pid_t target_pid);
 
 
+/**
+ * @brief Send multiple messages at once (non-blocking).
+ *
+ * Delivers up to @p num messages to @p target_pid within a single critical
+ * section and triggers at most one reschedule afterwards. If the receiver is
+ * waiting, the first message is delivered directly, all remaining messages
+ * are put into the receiver's message queue in order. Delivery stops at the
+ * first message that does not fit into the queue. This function never
+ * blocks and may be called from ISR context.
+ *
+ * Use together with @ref msg_receive_batch() to move bursts of messages
+ * between threads with a single context switch.
+ *
+ * @param[in] m             Array of @p num preallocated ``msg_t``
+ *                          structures, must not be NULL.
+ * @param[in] num           Number of messages in @p m
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return number of messages delivered, the first `return` messages of @p m
+ *         have been sent
+ * @return -1, on error (invalid PID)
+ */
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
 /**
  * @brief Send a message to the current thread.
  * @details Will work only if the thread has a message queue.
@@ -309,6 +345,22 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive multiple messages at once.
+ *
+ * This function blocks until at least one message was received. Then all
+ * further messages pending in the message queue or from blocked senders are
+ * taken in order within a single critical section, up to @p num messages in
+ * total.
+ *
+ * @param[out] m    Array of @p num preallocated ``msg_t`` structures, must
+ *                  not be NULL.
+ * @param[in]  num  Maximum number of messages to receive, must be > 0
+ *
+ * @return  number of messages received (at least 1)
+ */
+int msg_receive_batch(msg_t *m, unsigned num);
+
 /**
  * @brief Send a message, block until reply received.
  *
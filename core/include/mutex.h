@@ -91,6 +91,38 @@
  *       `MUTEX_LOCK`.
  *     - The scheduler is run, so that if the unblocked waiting thread can
  *       run now, in case it has a higher priority than the running thread.
+ *
+ * Priority Inheritance
+ * --------------------
+ *
+ * When the module `core_mutex_priority_inheritance` is used, each mutex keeps
+ * track of the thread holding it. If a thread blocks on a mutex held by a
+ * thread of lower priority (higher numeric value), the holder temporarily
+ * runs at the priority of the blocked thread via @ref sched_change_priority.
+ * Whenever it unlocks a mutex, or a waiter gives up on a timeout (e.g. in
+ * xtimer_mutex_lock_timeout()), its priority is recomputed from the waiters
+ * of the mutexes it still holds and its base priority (thread_t::base_priority),
+ * so mutexes may be unlocked in any order. This bounds the time a high
+ * priority thread can be blocked behind a low priority thread by threads of
+ * medium priority (priority inversion).
+ *
+ * Limitations: The inheritance is not transitive (a boosted holder blocking on
+ * a second mutex does not boost that mutex' holder). A mutex must be unlocked
+ * before it goes out of scope, as it stays linked into the list of its owner.
+ *
+ * Adaptive Locking
+ * ----------------
+ *
+ * When the module `core_mutex_adaptive` is used, `mutex_lock()` on a mutex
+ * that is locked without waiters first polls the mutex with interrupts
+ * enabled up to @ref CONFIG_MUTEX_SPIN_COUNT times before blocking. This
+ * avoids two context switches for mutexes that are held only for a few
+ * hundred cycles by an entity that can make progress while the caller spins,
+ * e.g. a driver mutex released from the transfer complete ISR. As RIOT
+ * schedules all threads on a single core, a mutex held by a (preempted)
+ * thread will not be released while spinning; this is the price paid in the
+ * worst case. Each mutex counts contended lock attempts and how many of them
+ * were resolved by spinning in @ref mutex_t::stats.
  * @{
  *
  * @file
@@ -114,6 +146,28 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of times to poll a locked mutex before blocking
+ *
+ * Only used with module `core_mutex_adaptive`.
+ */
+#ifndef CONFIG_MUTEX_SPIN_COUNT
+#define CONFIG_MUTEX_SPIN_COUNT     (32U)
+#endif
+
+#if defined(MODULE_CORE_MUTEX_ADAPTIVE) || defined(DOXYGEN)
+/**
+ * @brief   Contention counters of a mutex
+ *
+ * @note    Only available if module core_mutex_adaptive is used.
+ */
+typedef struct {
+    uint32_t contended;     /**< lock attempts that found the mutex locked */
+    uint32_t spun;          /**< contended attempts that obtained the mutex
+                                 while spinning, without blocking */
+} mutex_stats_t;
+#endif
+
 /**
  * @brief Mutex structure. Must never be modified by the user.
  */
@@ -124,18 +178,71 @@ typedef struct {
      * @internal
      */
     list_node_t queue;
+#if defined(DOXYGEN) || defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    /**
+     * @brief   The current owner of the mutex or `KERNEL_PID_UNDEF`
+     * @note    Only available if module core_mutex_priority_inheritance
+     *          is used.
+     * @internal
+     */
+    kernel_pid_t owner;
+    /**
+     * @brief   Entry in the list of mutexes held by the owner
+     *          (thread_t::mutexes)
+     * @note    Only available if module core_mutex_priority_inheritance
+     *          is used.
+     * @internal
+     */
+    list_node_t owned;
+#endif
+#if defined(DOXYGEN) || defined(MODULE_CORE_MUTEX_ADAPTIVE)
+    /**
+     * @brief   Contention counters
+     * @note    Only available if module core_mutex_adaptive is used.
+     */
+    mutex_stats_t stats;
+#endif
 } mutex_t;
 
 /**
  * @brief Static initializer for mutex_t.
  * @details This initializer is preferable to mutex_init().
  */
-#define MUTEX_INIT { { NULL } }
+#ifdef __cplusplus
+/* C++ warns about members omitted from designated initializers, value
+ * initialization of all members yields an unlocked mutex just as well */
+#define MUTEX_INIT { }
+#else
+#define MUTEX_INIT { .queue = { .next = NULL } }
+#endif
 
 /**
  * @brief Static initializer for mutex_t with a locked mutex
  */
-#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } }
+#ifdef __cplusplus
+/* designated initializers are C++20, so all optional members are listed */
+#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } MUTEX_INIT_OWNER MUTEX_INIT_STATS }
+#else
+#define MUTEX_INIT_LOCKED { .queue = { .next = MUTEX_LOCKED } }
+#endif
+
+/**
+ * @cond INTERNAL
+ * @brief Initializers of the optional members of mutex_t for C++
+ */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+#define MUTEX_INIT_OWNER , KERNEL_PID_UNDEF, { NULL }
+#else
+#define MUTEX_INIT_OWNER
+#endif
+#ifdef MODULE_CORE_MUTEX_ADAPTIVE
+#define MUTEX_INIT_STATS , { 0, 0 }
+#else
+#define MUTEX_INIT_STATS
+#endif
+/**
+ * @endcond
+ */
 
 /**
  * @cond INTERNAL
@@ -156,8 +263,68 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    mutex->owner = KERNEL_PID_UNDEF;
+#endif
+#ifdef MODULE_CORE_MUTEX_ADAPTIVE
+    mutex->stats.contended = 0;
+    mutex->stats.spun = 0;
+#endif
 }
 
+/**
+ * @cond INTERNAL
+ * @brief   Record the calling thread as owner of @p mutex
+ *
+ * @pre     Interrupts are disabled and the calling thread just obtained
+ *          @p mutex
+ */
+static inline void _mutex_set_owner(mutex_t *mutex)
+{
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread_t *me = thread_get_active();
+    mutex->owner = me->pid;
+    list_add(&me->mutexes, &mutex->owned);
+#else
+    (void)mutex;
+#endif
+}
+
+/**
+ * @brief   Raise the owner of @p mutex to the priority of the calling thread
+ *
+ * @pre     Interrupts are disabled and the calling thread was just queued on
+ *          @p mutex
+ */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+void _mutex_inherit_priority(mutex_t *mutex);
+#else
+static inline void _mutex_inherit_priority(mutex_t *mutex)
+{
+    (void)mutex;
+}
+#endif
+
+/**
+ * @brief   Lower the owner of @p mutex to the priority of the remaining
+ *          waiters of the mutexes it holds, or to its base priority if there
+ *          are none
+ *
+ * @pre     Interrupts are disabled and a waiter just left the queue of
+ *          @p mutex without obtaining it, e.g. on a timeout
+ */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+void _mutex_update_owner_priority(mutex_t *mutex);
+#else
+static inline void _mutex_update_owner_priority(mutex_t *mutex)
+{
+    (void)mutex;
+}
+#endif
+/**
+ * @endcond
+ */
+
 /**
  * @brief   Tries to get a mutex, non-blocking.
  *
@@ -176,6 +343,7 @@ static inline int mutex_trylock(mutex_t *mutex)
     int retval = 0;
     if (mutex->queue.next == NULL) {
         mutex->queue.next = MUTEX_LOCKED;
+        _mutex_set_owner(mutex);
         retval = 1;
     };
     irq_restore(irq_state);
@@ -80,6 +80,7 @@
 #ifndef SCHED_H
 #define SCHED_H
 
+#include <stdbool.h>
 #include <stddef.h>
 #include "kernel_defines.h"
 #include "kernel_types.h"
@@ -167,6 +168,24 @@ void sched_set_status(thread_t *process, thread_status_t status);
  */
 void sched_switch(uint16_t other_prio);
 
+/**
+ * @brief   Change the priority of the given thread
+ *
+ * If the thread is runnable, it is moved to the runqueue of its new priority.
+ * If the change results in a different scheduling decision (the running
+ * thread got a lower priority, or a runnable thread now has a higher priority
+ * than the running one), a context switch is requested.
+ *
+ * @note    This is used by @ref core_sync_mutex for priority inheritance.
+ *          Changing the priority of a thread that is waiting in a priority
+ *          sorted list (e.g. of a mutex) does not update its position in
+ *          that list.
+ *
+ * @param[in,out]   thread  The thread to change the priority of
+ * @param[in]       prio    The new priority
+ */
+void sched_change_priority(thread_t *thread, uint8_t prio);
+
 /**
  * @brief   Call context switching at thread exit
  */
@@ -233,6 +252,92 @@ typedef void (*sched_callback_t)(kernel_pid_t active, kernel_pid_t next);
 void sched_register_cb(sched_callback_t callback);
 #endif /* MODULE_SCHED_CB */
 
+#if IS_USED(MODULE_SCHED_RUNQ_CALLBACK) || defined(DOXYGEN)
+/**
+ * @brief   Scheduler runqueue (change) callback
+ *
+ * @details Function has to be provided by the user of this API. It will be
+ *          called with interrupts disabled:
+ *          - when the scheduler switched to the next thread to run,
+ *          - when a thread is added to a runqueue, and
+ *          - when a thread is removed from a runqueue.
+ *
+ * @warning This API is intended for in-tree scheduling policies such as
+ *          @ref sys_sched_round_robin only.
+ *
+ * @param   prio    the priority of the runqueue that changed
+ */
+extern void sched_runq_callback(uint8_t prio);
+#endif
+
+#if IS_USED(MODULE_SCHED_WAKEUP_CALLBACK) || defined(DOXYGEN)
+/**
+ * @brief   Thread wakeup callback
+ *
+ * @details Function has to be provided by the user of this API. It will be
+ *          called with interrupts disabled whenever a thread that was not
+ *          runnable is added to its runqueue, e.g. when a blocked thread
+ *          receives a message or a sleeping thread is woken up.
+ *
+ * @warning This API is intended for in-tree users such as
+ *          @ref schedstatistics only.
+ *
+ * @param   thread  the thread that just became runnable
+ */
+extern void sched_wakeup_callback(thread_t *thread);
+#endif
+
+/**
+ * @brief   Tell if the runqueue of the given priority is empty
+ *
+ * @param[in]   prio    The priority of the runqueue to check
+ *
+ * @return  true if no thread of priority @p prio is runnable
+ */
+static inline bool sched_runq_is_empty(uint8_t prio)
+{
+    return sched_runqueues[prio].next == NULL;
+}
+
+/**
+ * @brief   Tell if the runqueue of the given priority has exactly one thread
+ *
+ * @param[in]   prio    The priority of the runqueue to check
+ *
+ * @return  true if exactly one thread of priority @p prio is runnable
+ */
+static inline bool sched_runq_exactly_one(uint8_t prio)
+{
+    return clist_exactly_one(&sched_runqueues[prio]);
+}
+
+/**
+ * @brief   Tell if the runqueue of the given priority has more than one thread
+ *
+ * @param[in]   prio    The priority of the runqueue to check
+ *
+ * @return  true if more than one thread of priority @p prio is runnable
+ */
+static inline bool sched_runq_more_than_one(uint8_t prio)
+{
+    return clist_more_than_one(&sched_runqueues[prio]);
+}
+
+/**
+ * @brief   Advance the runqueue of the given priority by one thread
+ *
+ * The thread at the head of the runqueue becomes the last one, the next
+ * thread of the same priority will be selected on the next scheduler run.
+ *
+ * @pre     Interrupts are disabled
+ *
+ * @param[in]   prio    The priority of the runqueue to advance
+ */
+static inline void sched_runq_advance(uint8_t prio)
+{
+    clist_lpoprpush(&sched_runqueues[prio]);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -164,15 +164,29 @@ struct _thread {
 
     clist_node_t rq_entry;          /**< run queue entry                */
 
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    uint8_t base_priority;          /**< priority without inherited
+                                         priorities                     */
+    list_node_t mutexes;            /**< mutexes held by this thread    */
+#endif
+
 #if defined(MODULE_CORE_MSG) || defined(MODULE_CORE_THREAD_FLAGS) \
     || defined(MODULE_CORE_MBOX) || defined(DOXYGEN)
     void *wait_data;                /**< used by msg, mbox and thread
                                          flags                          */
 #endif
 #if defined(MODULE_CORE_MSG) || defined(DOXYGEN)
+#if defined(MODULE_CORE_MSG_WAITERS_BITCACHE) || defined(DOXYGEN)
+    clist_node_t msg_waiters[SCHED_PRIO_LEVELS]; /**< per priority FIFO of
+                                         threads waiting for their message
+                                         to be delivered to this thread */
+    uint32_t msg_waiters_bitcache;  /**< bitmap of non-empty
+                                         thread_t::msg_waiters entries  */
+#else
     list_node_t msg_waiters;        /**< threads waiting for their message
                                          to be delivered to this thread
                                          (i.e. all blocked sends)       */
+#endif
     cib_t msg_queue;                /**< index of this [thread's message queue]
                                          (thread_t::msg_array), if any  */
     msg_t *msg_array;               /**< memory holding messages sent
@@ -33,6 +33,9 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#if MODULE_CORE_MSG_WAITERS_BITCACHE
+#include "bitarithm.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -41,6 +44,75 @@ static int _msg_receive(msg_t *m, int block);
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
                      unsigned state);
 
+#if MODULE_CORE_MSG_WAITERS_BITCACHE
+/* Blocked senders are kept in one FIFO per priority level, the non-empty
+ * levels are tracked in a bitmap using the same bit order as the scheduler's
+ * runqueue_bitcache. Adding and removing a waiter is thus O(1) regardless of
+ * the number of threads blocked on the receiver. */
+static inline uint32_t _waiters_bit(uint8_t priority)
+{
+#if defined(BITARITHM_HAS_CLZ)
+    return BIT31 >> priority;
+#else
+    return 1UL << priority;
+#endif
+}
+
+static inline bool _msg_waiters_empty(const thread_t *target)
+{
+    return target->msg_waiters_bitcache == 0;
+}
+
+static inline void _msg_waiters_add(thread_t *target, thread_t *sender)
+{
+    assert(sender->status < STATUS_ON_RUNQUEUE);
+
+    clist_rpush(&target->msg_waiters[sender->priority], &sender->rq_entry);
+    target->msg_waiters_bitcache |= _waiters_bit(sender->priority);
+}
+
+static inline thread_t *_msg_waiters_pop(thread_t *target)
+{
+    if (!target->msg_waiters_bitcache) {
+        return NULL;
+    }
+
+#if defined(BITARITHM_HAS_CLZ)
+    unsigned prio = 31 - bitarithm_msb(target->msg_waiters_bitcache);
+#else
+    unsigned prio = bitarithm_lsb(target->msg_waiters_bitcache);
+#endif
+    clist_node_t *next = clist_lpop(&target->msg_waiters[prio]);
+
+    if (!target->msg_waiters[prio].next) {
+        target->msg_waiters_bitcache &= ~_waiters_bit(prio);
+    }
+
+    return container_of(next, thread_t, rq_entry);
+}
+#else
+static inline bool _msg_waiters_empty(const thread_t *target)
+{
+    return target->msg_waiters.next == NULL;
+}
+
+static inline void _msg_waiters_add(thread_t *target, thread_t *sender)
+{
+    thread_add_to_list(&(target->msg_waiters), sender);
+}
+
+static inline thread_t *_msg_waiters_pop(thread_t *target)
+{
+    list_node_t *next = list_remove_head(&target->msg_waiters);
+
+    if (next == NULL) {
+        return NULL;
+    }
+
+    return container_of((clist_node_t *)next, thread_t, rq_entry);
+}
+#endif
+
 static int queue_msg(thread_t *target, const msg_t *m)
 {
     int n = cib_put(&(target->msg_queue));
@@ -147,7 +219,7 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
 
         sched_set_status(me, newstatus);
 
-        thread_add_to_list(&(target->msg_waiters), me);
+        _msg_waiters_add(target, me);
 
 #if MODULE_CORE_THREAD_FLAGS
         target->flags |= THREAD_FLAG_MSG_WAITING;
@@ -176,6 +248,57 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
     return 1;
 }
 
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+    const bool in_irq = irq_is_in();
+    const kernel_pid_t sender_pid = in_irq ? KERNEL_PID_ISR : thread_getpid();
+
+    unsigned state = irq_disable();
+
+    thread_t *target = thread_get_unchecked(target_pid);
+
+    if (target == NULL) {
+        DEBUG("msg_send_batch(): target thread %d does not exist\n",
+              target_pid);
+        irq_restore(state);
+        return -1;
+    }
+
+    unsigned n = 0;
+
+    if ((num > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("msg_send_batch(): Direct msg copy to %" PRIkernel_pid ".\n",
+              target_pid);
+        m[0].sender_pid = sender_pid;
+        *((msg_t *)target->wait_data) = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        n++;
+    }
+
+    for (; n < num; n++) {
+        m[n].sender_pid = sender_pid;
+        if (!queue_msg(target, &m[n])) {
+            break;
+        }
+    }
+
+    uint16_t target_prio = THREAD_PRIORITY_IDLE;
+    if ((n > 0) && (target->status >= STATUS_ON_RUNQUEUE)) {
+        target_prio = target->priority;
+    }
+
+    irq_restore(state);
+
+    DEBUG("msg_send_batch(): sent %u of %u messages to %" PRIkernel_pid "\n",
+          n, num, target_pid);
+
+    if (target_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(target_prio);
+    }
+
+    return n;
+}
+
 int msg_send_to_self(msg_t *m)
 {
     unsigned state = irq_disable();
@@ -355,7 +478,7 @@ static int _msg_receive(msg_t *m, int block)
     }
 
     /* no message, fail */
-    if ((!block) && ((!me->msg_waiters.next) && (queue_index == -1))) {
+    if ((!block) && (_msg_waiters_empty(me) && (queue_index == -1))) {
         irq_restore(state);
         return -1;
     }
@@ -369,9 +492,9 @@ static int _msg_receive(msg_t *m, int block)
         me->wait_data = (void *)m;
     }
 
-    list_node_t *next = list_remove_head(&me->msg_waiters);
+    thread_t *sender = _msg_waiters_pop(me);
 
-    if (next == NULL) {
+    if (sender == NULL) {
         DEBUG("_msg_receive: %" PRIkernel_pid ": _msg_receive(): No thread in "
               "waiting list.\n", thread_getpid());
 
@@ -396,9 +519,6 @@ static int _msg_receive(msg_t *m, int block)
         DEBUG("_msg_receive: %" PRIkernel_pid ": _msg_receive(): Waking up "
              "waiting thread.\n", thread_getpid());
 
-        thread_t *sender =
-            container_of((clist_node_t *)next, thread_t, rq_entry);
-
         if (queue_index >= 0) {
             /* We've already got a message from the queue. As there is a
              * waiter, take it's message into the just freed queue space.
@@ -428,6 +548,60 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+int msg_receive_batch(msg_t *m, unsigned num)
+{
+    assert(num > 0);
+
+    /* block until there is at least one message */
+    _msg_receive(&m[0], 1);
+
+    unsigned n = 1;
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+
+    while (n < num) {
+        int queue_index = -1;
+
+        if (thread_has_msg_queue(me)) {
+            queue_index = cib_get(&(me->msg_queue));
+        }
+
+        if (queue_index >= 0) {
+            m[n++] = me->msg_array[queue_index];
+            continue;
+        }
+
+        /* queue is drained, senders blocked on a full queue come next */
+        thread_t *sender = _msg_waiters_pop(me);
+
+        if (sender == NULL) {
+            break;
+        }
+
+        m[n++] = *((msg_t *)sender->wait_data);
+
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < sender_prio) {
+                sender_prio = sender->priority;
+            }
+        }
+    }
+
+    irq_restore(state);
+
+    DEBUG("msg_receive_batch(): %" PRIkernel_pid ": received %u messages\n",
+          thread_getpid(), n);
+
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+
+    return n;
+}
+
 int msg_avail(void)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
@@ -29,10 +29,139 @@
 #include "sched.h"
 #include "irq.h"
 #include "list.h"
+#ifdef MODULE_CORE_MUTEX_ADAPTIVE
+#include "atomic_utils.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+/* Let the owner of the mutex run at the priority of the thread blocking on
+ * it. Called with interrupts disabled. As the boosted owner has the same
+ * priority as the running thread, this never triggers a context switch. */
+void _mutex_inherit_priority(mutex_t *mutex)
+{
+    thread_t *me = thread_get_active();
+    thread_t *owner = thread_get(mutex->owner);
+
+    if ((owner) && (owner->priority > me->priority)) {
+        DEBUG("PID[%" PRIkernel_pid "]: boosting owner %" PRIkernel_pid
+              " to prio %u\n", me->pid, owner->pid, (unsigned)me->priority);
+        sched_change_priority(owner, me->priority);
+    }
+}
+
+/* Returns the priority @p thread is entitled to: its base priority, raised to
+ * that of the first waiter of every mutex it holds. Called with interrupts
+ * disabled. */
+static uint8_t _owner_priority(thread_t *thread)
+{
+    uint8_t prio = thread->base_priority;
+
+    for (list_node_t *node = thread->mutexes.next; node; node = node->next) {
+        mutex_t *mutex = container_of(node, mutex_t, owned);
+        if ((mutex->queue.next == NULL) || (mutex->queue.next == MUTEX_LOCKED)) {
+            continue;
+        }
+        /* the queue is sorted by priority */
+        thread_t *head = container_of((clist_node_t *)mutex->queue.next,
+                                      thread_t, rq_entry);
+        if (head->priority < prio) {
+            prio = head->priority;
+        }
+    }
+
+    return prio;
+}
+
+/* Let the owner of the mutex run at the priority it is still entitled to
+ * after a waiter left without obtaining the mutex, so the owner does not keep
+ * the priority of a thread that no longer waits. Called with interrupts
+ * disabled. */
+void _mutex_update_owner_priority(mutex_t *mutex)
+{
+    thread_t *owner = thread_get(mutex->owner);
+
+    if (!owner) {
+        return;
+    }
+
+    uint8_t prio = _owner_priority(owner);
+    if (owner->priority != prio) {
+        DEBUG("mutex: lowering owner %" PRIkernel_pid " to prio %u\n",
+              owner->pid, (unsigned)prio);
+        sched_change_priority(owner, prio);
+    }
+}
+
+/* Removes the mutex from the mutexes held by its owner. Returns the owner if
+ * its priority changes by this and stores the new priority in @p prio, so the
+ * caller can apply it once interrupts are enabled again. */
+static inline thread_t *_disinherit_owner(mutex_t *mutex, uint8_t *prio)
+{
+    thread_t *owner = thread_get(mutex->owner);
+
+    mutex->owner = KERNEL_PID_UNDEF;
+    *prio = 0;
+
+    if (!owner) {
+        return NULL;
+    }
+
+    list_remove(&owner->mutexes, &mutex->owned);
+    *prio = _owner_priority(owner);
+
+    if (owner->priority != *prio) {
+        return owner;
+    }
+
+    return NULL;
+}
+
+static inline void _pass_ownership(mutex_t *mutex, thread_t *process)
+{
+    mutex->owner = process->pid;
+    list_add(&process->mutexes, &mutex->owned);
+}
+#else
+static inline thread_t *_disinherit_owner(mutex_t *mutex, uint8_t *prio)
+{
+    (void)mutex;
+    *prio = 0;
+    return NULL;
+}
+
+static inline void _pass_ownership(mutex_t *mutex, thread_t *process)
+{
+    (void)mutex;
+    (void)process;
+}
+#endif
+
+#ifdef MODULE_CORE_MUTEX_ADAPTIVE
+/* Poll a mutex that is locked without waiters with interrupts enabled, so
+ * that an ISR (or the holder, if it runs elsewhere) can release it. Stop
+ * early once it is unlocked or other threads started queueing on it. */
+static inline void _spin(mutex_t *mutex)
+{
+    for (unsigned i = 0; i < CONFIG_MUTEX_SPIN_COUNT; i++) {
+        if (atomic_load_ptr((void **)&mutex->queue.next) != MUTEX_LOCKED) {
+            return;
+        }
+    }
+}
+#endif
+
+static inline void _restore_priority(thread_t *owner, uint8_t priority)
+{
+    if (owner) {
+        DEBUG("mutex: restoring prio %u of %" PRIkernel_pid "\n",
+              (unsigned)priority, owner->pid);
+        sched_change_priority(owner, priority);
+    }
+}
+
 int mutex_lock(mutex_t *mutex)
 {
     unsigned irq_state = irq_disable();
@@ -42,12 +171,31 @@ int mutex_lock(mutex_t *mutex)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+        _mutex_set_owner(mutex);
         DEBUG("PID[%" PRIkernel_pid "]: mutex_wait_and_lock early out.\n",
               thread_getpid());
         irq_restore(irq_state);
         return 0;
     }
 
+#ifdef MODULE_CORE_MUTEX_ADAPTIVE
+    mutex->stats.contended++;
+    if (mutex->queue.next == MUTEX_LOCKED) {
+        irq_restore(irq_state);
+        _spin(mutex);
+        irq_state = irq_disable();
+        if (mutex->queue.next == NULL) {
+            mutex->queue.next = MUTEX_LOCKED;
+            _mutex_set_owner(mutex);
+            mutex->stats.spun++;
+            DEBUG("PID[%" PRIkernel_pid "]: mutex obtained by spinning.\n",
+                  thread_getpid());
+            irq_restore(irq_state);
+            return 0;
+        }
+    }
+#endif
+
     thread_t *me = thread_get_active();
     DEBUG("PID[%" PRIkernel_pid "]: Adding node to mutex queue: prio: %"
           PRIu32 "\n", thread_getpid(), (uint32_t)me->priority);
@@ -60,6 +208,7 @@ int mutex_lock(mutex_t *mutex)
         thread_add_to_list(&mutex->queue, me);
     }
 
+    _mutex_inherit_priority(mutex);
 
     irq_restore(irq_state);
     thread_yield_higher();
@@ -80,10 +229,14 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
+    uint8_t owner_prio;
+    thread_t *owner = _disinherit_owner(mutex, &owner_prio);
+
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
         irq_restore(irqstate);
+        _restore_priority(owner, owner_prio);
         return;
     }
 
@@ -94,6 +247,7 @@ void mutex_unlock(mutex_t *mutex)
     DEBUG("mutex_unlock: waking up waiting thread %" PRIkernel_pid "\n",
           process->pid);
     sched_set_status(process, STATUS_PENDING);
+    _pass_ownership(mutex, process);
 
     if (!mutex->queue.next) {
         mutex->queue.next = MUTEX_LOCKED;
@@ -101,6 +255,7 @@ void mutex_unlock(mutex_t *mutex)
 
     uint16_t process_priority = process->priority;
     irq_restore(irqstate);
+    _restore_priority(owner, owner_prio);
     sched_switch(process_priority);
 }
 
@@ -109,8 +264,12 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     DEBUG("PID[%" PRIkernel_pid "]: unlocking mutex. queue.next: %p, and "
           "taking a nap\n", thread_getpid(), (void *)mutex->queue.next);
     unsigned irqstate = irq_disable();
+    thread_t *owner = NULL;
+    uint8_t owner_prio = 0;
 
     if (mutex->queue.next) {
+        owner = _disinherit_owner(mutex, &owner_prio);
+
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
         }
@@ -120,6 +279,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
                                              rq_entry);
             DEBUG("PID[%" PRIkernel_pid "]: waking up waiter.\n", process->pid);
             sched_set_status(process, STATUS_PENDING);
+            _pass_ownership(mutex, process);
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
@@ -127,7 +287,14 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     }
 
     DEBUG("PID[%" PRIkernel_pid "]: going to sleep.\n", thread_getpid());
-    sched_set_status(thread_get_active(), STATUS_SLEEPING);
+    thread_t *me = thread_get_active();
+    sched_set_status(me, STATUS_SLEEPING);
+    if (owner == me) {
+        /* off the runqueue now, so restoring needs no runqueue move */
+        me->priority = owner_prio;
+        owner = NULL;
+    }
     irq_restore(irqstate);
+    _restore_priority(owner, owner_prio);
     thread_yield_higher();
 }
@@ -19,6 +19,8 @@
  * @}
  */
 
+#include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <inttypes.h>
 
@@ -207,6 +209,10 @@ thread_t *__attribute__((used)) sched_run(void)
         DEBUG("sched_run: done, changed sched_active_thread.\n");
     }
 
+#ifdef MODULE_SCHED_RUNQ_CALLBACK
+    sched_runq_callback(nextrq);
+#endif
+
     return next_thread;
 }
 
@@ -220,6 +226,12 @@ void sched_set_status(thread_t *process, thread_status_t status)
             clist_rpush(&sched_runqueues[process->priority],
                         &(process->rq_entry));
             _set_runqueue_bit(process);
+#ifdef MODULE_SCHED_RUNQ_CALLBACK
+            sched_runq_callback(process->priority);
+#endif
+#ifdef MODULE_SCHED_WAKEUP_CALLBACK
+            sched_wakeup_callback(process);
+#endif
         }
     }
     else {
@@ -232,6 +244,9 @@ void sched_set_status(thread_t *process, thread_status_t status)
             if (!sched_runqueues[process->priority].next) {
                 _clear_runqueue_bit(process);
             }
+#ifdef MODULE_SCHED_RUNQ_CALLBACK
+            sched_runq_callback(process->priority);
+#endif
         }
     }
 
@@ -264,6 +279,65 @@ void sched_switch(uint16_t other_prio)
     }
 }
 
+void sched_change_priority(thread_t *thread, uint8_t prio)
+{
+    assert(thread && (prio < SCHED_PRIO_LEVELS));
+
+    if (thread->priority == prio) {
+        return;
+    }
+
+    unsigned irq_state = irq_disable();
+    bool on_runqueue = (thread->status >= STATUS_ON_RUNQUEUE);
+
+    DEBUG("sched_change_priority: thread %" PRIkernel_pid " prio %" PRIu8
+          " -> %" PRIu8 "\n", thread->pid, thread->priority, prio);
+
+    if (on_runqueue) {
+        uint8_t old_prio = thread->priority;
+
+        clist_remove(&sched_runqueues[old_prio], &thread->rq_entry);
+        if (!sched_runqueues[old_prio].next) {
+            _clear_runqueue_bit(thread);
+        }
+#ifdef MODULE_SCHED_RUNQ_CALLBACK
+        sched_runq_callback(old_prio);
+#endif
+    }
+
+    thread->priority = prio;
+
+    if (on_runqueue) {
+        /* the running thread has to stay the head of its runqueue */
+        if (thread == thread_get_active()) {
+            clist_lpush(&sched_runqueues[prio], &thread->rq_entry);
+        }
+        else {
+            clist_rpush(&sched_runqueues[prio], &thread->rq_entry);
+        }
+        _set_runqueue_bit(thread);
+#ifdef MODULE_SCHED_RUNQ_CALLBACK
+        sched_runq_callback(prio);
+#endif
+    }
+
+    thread_t *active = thread_get_active();
+    bool yield = (active == thread) ||
+                 (on_runqueue && active && (active->priority > prio));
+
+    irq_restore(irq_state);
+
+    if (yield) {
+        /* the change in priority may result in a different thread to run */
+        if (irq_is_in()) {
+            sched_context_switch_request = 1;
+        }
+        else {
+            thread_yield_higher();
+        }
+    }
+}
+
 NORETURN void sched_task_exit(void)
 {
     DEBUG("sched_task_exit: ending thread %" PRIkernel_pid "...\n",
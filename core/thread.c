@@ -20,6 +20,7 @@
 
 #include <errno.h>
 #include <stdio.h>
+#include <string.h>
 #ifdef PICOLIBC_TLS
 #include <picotls.h>
 #endif
@@ -289,9 +290,19 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
 
     thread->rq_entry.next = NULL;
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread->base_priority = priority;
+    thread->mutexes.next = NULL;
+#endif
+
 #ifdef MODULE_CORE_MSG
     thread->wait_data = NULL;
+#ifdef MODULE_CORE_MSG_WAITERS_BITCACHE
+    memset(thread->msg_waiters, 0, sizeof(thread->msg_waiters));
+    thread->msg_waiters_bitcache = 0;
+#else
     thread->msg_waiters.next = NULL;
+#endif
     cib_init(&(thread->msg_queue), 0);
     thread->msg_array = NULL;
 #endif
@@ -55,6 +55,11 @@ extern "C" {
  */
 #define NATIVE_ETH_PROTO 0x1234
 
+/**
+ * @brief   native provides inet_csum_arch()
+ */
+#define INET_CSUM_HAS_ARCH
+
 #if (defined(CONFIG_GNRC_PKTBUF_SIZE)) && (CONFIG_GNRC_PKTBUF_SIZE < 2048)
 #   undef  CONFIG_GNRC_PKTBUF_SIZE
 #   define CONFIG_GNRC_PKTBUF_SIZE     (2048)
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpu_native
+ * @{
+ *
+ * @file
+ * @brief       Internet checksum summation for 'native'
+ *
+ * The 32-bit words are summed up in 64-bit accumulators, so no carry needs
+ * to be added back in until the end. With SSE2, four words are summed up in
+ * two accumulators per iteration.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "net/inet_csum.h"
+
+uint32_t inet_csum_arch(const uint8_t *buf, size_t len)
+{
+    uint64_t sum = 0;
+
+#ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+
+    for (; len >= sizeof(__m128i); buf += sizeof(__m128i),
+                                   len -= sizeof(__m128i)) {
+        __m128i words = _mm_loadu_si128((const __m128i *)buf);
+
+        /* zero extend the 32-bit words to 64 bit */
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(words, zero));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(words, zero));
+    }
+
+    uint64_t lanes[2];
+
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    sum = lanes[0] + lanes[1];
+#endif
+
+    for (; len >= sizeof(uint32_t); buf += sizeof(uint32_t),
+                                    len -= sizeof(uint32_t)) {
+        uint32_t word;
+
+        memcpy(&word, buf, sizeof(word));
+        sum += word;
+    }
+
+    /* add the carries out of bit 31 back in */
+    sum = (sum & UINT32_MAX) + (sum >> 32);
+    sum = (sum & UINT32_MAX) + (sum >> 32);
+
+    return (uint32_t)sum;
+}
@@ -40,6 +40,10 @@
 
 #include "native_internal.h"
 
+#ifdef MODULE_SCHEDSTATISTICS
+#include "schedstatistics.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -254,6 +258,10 @@ void native_irq_handler(void)
 {
     DEBUG("\n\n\t\tnative_irq_handler\n\n");
 
+#ifdef MODULE_SCHEDSTATISTICS
+    sched_statistics_isr_enter();
+#endif
+
     while (_native_sigpend > 0) {
         int sig = _native_popsig();
         _native_sigpend--;
@@ -271,6 +279,9 @@ void native_irq_handler(void)
     }
 
     DEBUG("native_irq_handler: return\n");
+#ifdef MODULE_SCHEDSTATISTICS
+    sched_statistics_isr_exit();
+#endif
     cpu_switch_context_exit();
 }
 
@@ -217,6 +217,8 @@ class IfconfigStatsParser(ShellInteractionParser):
                                r"bytes\s+(?P<bytes>\d+)$")
         self.tx_err_c = re.compile(r"TX succeeded\s+(?P<succeeded>\d+)\s+"
                                    r"errors\s+(?P<errors>\d+)$")
+        self.tx_copied_c = re.compile(r"TX copied bytes\s+(?P<copied>\d+)\s+"
+                                      r"\(\d+ per packet\)$")
 
     def parse(self, cmd_output):
         """
@@ -233,7 +235,8 @@ class IfconfigStatsParser(ShellInteractionParser):
         ...         "Statistics for IPv6\\n"
         ...         "  RX packets 14  bytes 1104\\n"
         ...         "  TX packets 3 (Multicast: 1)  bytes 192\\n"
-        ...         "  TX succeeded 3 errors 0\\n")
+        ...         "  TX succeeded 3 errors 0\\n"
+        ...         "  TX copied bytes 0 (0 per packet)\\n")
         >>> sorted(res)
         ['IPv6']
         >>> sorted(res["IPv6"])
@@ -241,7 +244,7 @@ class IfconfigStatsParser(ShellInteractionParser):
         >>> sorted(res["IPv6"]["rx"])
         ['bytes', 'packets']
         >>> sorted(res["IPv6"]["tx"])
-        ['bytes', 'errors', 'multicast', 'packets', 'succeeded']
+        ['bytes', 'copied', 'errors', 'multicast', 'packets', 'succeeded']
         >>> res["IPv6"]["rx"]["bytes"]
         1104
         """
@@ -267,11 +270,12 @@ class IfconfigStatsParser(ShellInteractionParser):
                         current["tx"] = {k: int(v)
                                          for k, v in m.groupdict().items()}
                 elif "tx" in current:
-                    m = self.tx_err_c.search(line)
-                    if m is not None:
-                        current["tx"].update(
-                            {k: int(v) for k, v in m.groupdict().items()}
-                        )
+                    for regex in (self.tx_err_c, self.tx_copied_c):
+                        m = regex.search(line)
+                        if m is not None:
+                            current["tx"].update(
+                                {k: int(v) for k, v in m.groupdict().items()}
+                            )
         return stats
 
 
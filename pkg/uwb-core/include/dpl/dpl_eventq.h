@@ -218,7 +218,7 @@ static inline void dpl_eventq_run(struct dpl_eventq *evq)
  */
 static inline bool dpl_eventq_is_empty(struct dpl_eventq *evq)
 {
-    return clist_count(&(evq->q.event_list)) == 0;
+    return event_queue_is_empty(&evq->q);
 }
 
 /**
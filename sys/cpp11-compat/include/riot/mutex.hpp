@@ -47,7 +47,7 @@ public:
    */
   using native_handle_type = mutex_t*;
 
-  inline constexpr mutex() noexcept : m_mtx{{0}} {}
+  inline constexpr mutex() noexcept : m_mtx{} {}
   ~mutex();
 
   /**
@@ -22,7 +22,8 @@
  */
 
 #include <assert.h>
-
+#include <stdalign.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include "event.h"
@@ -33,6 +34,192 @@
 #include "xtimer.h"
 #endif
 
+#ifdef MODULE_EVENT_MPSC
+/*
+ * Events posted to a queue are first pushed onto queue->pending, a singly
+ * linked LIFO list that is only ever modified using atomic operations by
+ * producers, and detached as a whole by the consumer. The last node of that
+ * list points to itself, so that `list_node.next != NULL` still tells whether
+ * an event is queued.
+ *
+ * A producer claims an event before pushing it. An event_cancel() preempting
+ * the producer in between can neither find the event nor wait for the
+ * producer to finish, so it sets the lowest bit of `list_node.next` instead.
+ * The producer keeps that bit while pushing and the consumer drops events
+ * carrying it.
+ */
+#define CANCELLED   ((uintptr_t)1U)
+
+static_assert(alignof(clist_node_t) >= 2,
+              "event_mpsc needs the lowest bit of event_t pointers to be zero");
+
+static inline bool _cancelled(clist_node_t *node)
+{
+    return (uintptr_t)__atomic_load_n(&node->next, __ATOMIC_RELAXED) & CANCELLED;
+}
+
+static inline clist_node_t *_pending_next(clist_node_t *node)
+{
+    clist_node_t *next = (clist_node_t *)((uintptr_t)node->next & ~CANCELLED);
+
+    return (next == node) ? NULL : next;
+}
+
+/* returns false, if the event was already queued */
+static bool _mpsc_claim(clist_node_t *node)
+{
+    while (1) {
+        clist_node_t *cur = __atomic_load_n(&node->next, __ATOMIC_RELAXED);
+        if (!cur) {
+            if (__atomic_compare_exchange_n(&node->next, &cur, node, false,
+                                            __ATOMIC_ACQUIRE,
+                                            __ATOMIC_RELAXED)) {
+                return true;
+            }
+        }
+        else if (!((uintptr_t)cur & CANCELLED)) {
+            return false;
+        }
+        /* posted again after a cancel raced with the producer: the push of
+         * that producer is still going to happen, just make it count again */
+        else if (__atomic_compare_exchange_n(&node->next, &cur,
+                                             (clist_node_t *)((uintptr_t)cur & ~CANCELLED),
+                                             false, __ATOMIC_RELAXED,
+                                             __ATOMIC_RELAXED)) {
+            return false;
+        }
+    }
+}
+
+static void _mpsc_push(event_queue_t *queue, event_t *event)
+{
+    clist_node_t *node = &event->list_node;
+
+    if (!_mpsc_claim(node)) {
+        return;
+    }
+
+    clist_node_t *cur = node;
+    clist_node_t *head = __atomic_load_n(&queue->pending, __ATOMIC_RELAXED);
+    do {
+        clist_node_t *link;
+        /* link to the current head, keeping a cancellation of the event */
+        do {
+            link = (clist_node_t *)((uintptr_t)(head ? head : node) |
+                                    ((uintptr_t)cur & CANCELLED));
+        } while (!__atomic_compare_exchange_n(&node->next, &cur, link, false,
+                                              __ATOMIC_RELAXED,
+                                              __ATOMIC_RELAXED));
+        cur = link;
+    } while (!__atomic_compare_exchange_n(&queue->pending, &head, node, true,
+                                          __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+/* must be called with interrupts disabled */
+static void _mpsc_drain(event_queue_t *queue)
+{
+    clist_node_t *node = __atomic_exchange_n(&queue->pending, NULL,
+                                             __ATOMIC_ACQUIRE);
+    clist_node_t *anchor = queue->event_list.next;
+    bool first = true;
+
+    /* The pending events are in reverse order. Inserting each one right
+     * behind the old tail (or the first one inserted, if the queue was empty)
+     * restores the order in which they were posted. */
+    while (node) {
+        clist_node_t *next = _pending_next(node);
+        if (_cancelled(node)) {
+            node->next = NULL;
+        }
+        else if (!anchor) {
+            node->next = node;
+            anchor = node;
+        }
+        else {
+            node->next = anchor->next;
+            anchor->next = node;
+        }
+        if (first && (node->next != NULL)) {
+            queue->event_list.next = node;
+            first = false;
+        }
+        node = next;
+    }
+}
+
+/* must be called with interrupts disabled */
+static bool _mpsc_remove(event_queue_t *queue, clist_node_t *node)
+{
+    clist_node_t *prev = NULL;
+
+    for (clist_node_t *cur = queue->pending; cur; cur = _pending_next(cur)) {
+        if (cur == node) {
+            clist_node_t *next = _pending_next(cur);
+            if (prev) {
+                /* keep a cancellation of the predecessor */
+                prev->next = (clist_node_t *)(((uintptr_t)prev->next & CANCELLED) |
+                                              (uintptr_t)(next ? next : prev));
+            }
+            else {
+                queue->pending = next;
+            }
+            return true;
+        }
+        prev = cur;
+    }
+
+    return false;
+}
+
+/* must be called with interrupts disabled */
+static clist_node_t *_lpop(event_queue_t *queue)
+{
+    /* events in event_list were all posted before the pending ones */
+    if (!queue->event_list.next) {
+        _mpsc_drain(queue);
+    }
+    return clist_lpop(&queue->event_list);
+}
+
+void event_post(event_queue_t *queue, event_t *event)
+{
+    assert(queue && event);
+
+    _mpsc_push(queue, event);
+
+    thread_t *waiter = queue->waiter;
+    /* if the event flag is still set, the owner did not yet look for events
+     * and will pick this one up as well: spare the interrupt lock */
+    if (waiter && !(__atomic_load_n(&waiter->flags, __ATOMIC_RELAXED) &
+                    THREAD_FLAG_EVENT)) {
+        thread_flags_set(waiter, THREAD_FLAG_EVENT);
+    }
+}
+
+void event_cancel(event_queue_t *queue, event_t *event)
+{
+    assert(queue);
+    assert(event);
+
+    clist_node_t *node = &event->list_node;
+    unsigned state = irq_disable();
+    if (_mpsc_remove(queue, node) ||
+        clist_remove(&queue->event_list, node)) {
+        node->next = NULL;
+    }
+    else if (node->next) {
+        /* claimed by a producer that was interrupted before pushing it */
+        __atomic_fetch_or((uintptr_t *)&node->next, CANCELLED,
+                          __ATOMIC_RELAXED);
+    }
+    irq_restore(state);
+}
+#else /* MODULE_EVENT_MPSC */
+static inline clist_node_t *_lpop(event_queue_t *queue)
+{
+    return clist_lpop(&queue->event_list);
+}
+
 void event_post(event_queue_t *queue, event_t *event)
 {
     assert(queue && event);
@@ -59,11 +246,12 @@ void event_cancel(event_queue_t *queue, event_t *event)
     event->list_node.next = NULL;
     irq_restore(state);
 }
+#endif /* MODULE_EVENT_MPSC */
 
 event_t *event_get(event_queue_t *queue)
 {
     unsigned state = irq_disable();
-    event_t *result = (event_t *) clist_lpop(&queue->event_list);
+    event_t *result = (event_t *) _lpop(queue);
     irq_restore(state);
 
     if (result) {
@@ -80,8 +268,7 @@ event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
     do {
         unsigned state = irq_disable();
         for (size_t i = 0; i < n_queues; i++) {
-            result = container_of(clist_lpop(&queues[i].event_list),
-                                  event_t, list_node);
+            result = container_of(_lpop(&queues[i]), event_t, list_node);
             if (result) {
                 break;
             }
@@ -236,6 +236,20 @@ static inline uint32_t atomic_load_u32(const uint32_t *var);
  * @return  The value stored in @p var
  */
 static inline uint64_t atomic_load_u64(const uint64_t *var);
+/**
+ * @brief   Load an `uintptr_t` atomically
+ *
+ * @param[in]       var     Variable to load atomically
+ * @return  The value stored in @p var
+ */
+static inline uintptr_t atomic_load_uintptr(const uintptr_t *var);
+/**
+ * @brief   Load a `void *` atomically
+ *
+ * @param[in]       ptr_addr    Address of the pointer to load atomically
+ * @return  The value of the pointer stored at @p ptr_addr
+ */
+static inline void *atomic_load_ptr(void **ptr_addr);
 /** @} */
 
 /**
@@ -737,6 +751,24 @@ ATOMIC_LOAD_IMPL(u32, uint32_t)
 ATOMIC_LOAD_IMPL(u64, uint64_t)
 #endif
 
+static inline uintptr_t atomic_load_uintptr(const uintptr_t *var)
+{
+    if (sizeof(uintptr_t) == 2) {
+        return atomic_load_u16((const uint16_t *)var);
+    }
+    else if (sizeof(uintptr_t) == 4) {
+        return atomic_load_u32((const uint32_t *)(uintptr_t)var);
+    }
+    else {
+        return atomic_load_u64((const uint64_t *)(uintptr_t)var);
+    }
+}
+
+static inline void *atomic_load_ptr(void **ptr_addr)
+{
+    return (void *)atomic_load_uintptr((const uintptr_t *)ptr_addr);
+}
+
 /**
  * @brief   Generates a static inline function implementing
  *          `atomic_store_u<width>()`
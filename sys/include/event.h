@@ -47,6 +47,24 @@
  * to be queued. Thus event queues can be used safely and efficiently in combination
  * with thread flags and msg queues.
  *
+ * Lock-free posting
+ * =================
+ *
+ * By default, event_post() disables interrupts while appending the event to
+ * the queue. When using the module `event_mpsc`, events are instead pushed
+ * onto a lock-free multi-producer single-consumer list using atomic compare
+ * and swap operations, which the owning thread moves into its queue the next
+ * time it runs out of events. Interrupts only need to be disabled in the
+ * posting context in order to wake up a waiting owner thread. This reduces the
+ * interrupt latency added by posting events from many ISRs, at the cost of
+ * slightly more work on the consumer side. The API is unchanged.
+ *
+ * @note    On platforms without atomic compare and swap instructions (e.g.
+ *          Cortex-M0, AVR, MSP430) the atomic operations are emulated by
+ *          disabling interrupts, so `event_mpsc` brings no benefit there.
+ *          On 8-bit platforms `event_mpsc` is not available at all, as it
+ *          marks cancelled events in the lowest bit of an aligned pointer.
+ *
  * Examples:
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
@@ -96,6 +114,7 @@
 #ifndef EVENT_H
 #define EVENT_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -150,6 +169,11 @@ struct event {
 typedef struct {
     clist_node_t event_list;    /**< list of queued events              */
     thread_t *waiter;           /**< thread ownning event queue         */
+#if defined(MODULE_EVENT_MPSC) || defined(DOXYGEN)
+    clist_node_t *pending;      /**< events posted, but not yet moved to
+                                     @ref event_queue_t::event_list
+                                     (LIFO, lock-free)                  */
+#endif
 } event_queue_t;
 
 
@@ -270,6 +294,26 @@ void event_post(event_queue_t *queue, event_t *event);
  */
 void event_cancel(event_queue_t *queue, event_t *event);
 
+/**
+ * @brief   Check if an event queue holds no events
+ *
+ * With module `event_mpsc`, events posted but not yet moved onto the main
+ * list by the consumer count as queued.
+ *
+ * @param[in]   queue   event queue to check
+ *
+ * @return  true if no event is queued in @p queue
+ */
+static inline bool event_queue_is_empty(const event_queue_t *queue)
+{
+#ifdef MODULE_EVENT_MPSC
+    if (__atomic_load_n(&queue->pending, __ATOMIC_RELAXED)) {
+        return false;
+    }
+#endif
+    return queue->event_list.next == NULL;
+}
+
 /**
  * @brief   Get next event from event queue, non-blocking
  *
@@ -141,7 +141,7 @@ static inline uint32_t evtimer_now_msec(void)
 static inline uint32_t evtimer_now_min(void)
 {
 #if IS_USED(MODULE_EVTIMER_ON_ZTIMER)
-    return ztimer_now(ZTIMER_MSEC) / (MS_PER_SEC * SEC_PER_MIN);
+    return ztimer_now64(ZTIMER_MSEC) / (MS_PER_SEC * SEC_PER_MIN);
 #else
     return xtimer_now_usec64() / (US_PER_SEC * SEC_PER_MIN);
 #endif
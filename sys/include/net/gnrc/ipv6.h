@@ -149,6 +149,19 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_MSG_QUEUE_SIZE_EXP    (3U)
 #endif
 
+/**
+ * @brief   Number of destinations in the route cache
+ *
+ * With module `gnrc_ipv6_route_cache` the IPv6 thread remembers the next hop
+ * and the source address it chose for this many destinations of unicast
+ * packets. The entries are invalidated whenever the
+ * @ref net_gnrc_ipv6_nib "NIB" changes, so they are only used for as long as
+ * asking the NIB would yield the same result.
+ */
+#ifndef CONFIG_GNRC_IPV6_ROUTE_CACHE_SIZE
+#define CONFIG_GNRC_IPV6_ROUTE_CACHE_SIZE      (4U)
+#endif
+
 #ifdef DOXYGEN
 /**
  * @brief   Add a static IPv6 link local address to any network interface
@@ -328,6 +328,22 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
                                       gnrc_ipv6_nib_nc_t *nce);
 
+/**
+ * @brief   Gets the current generation of the NIB
+ *
+ * The generation advances with every change of the NIB that might change the
+ * result of a lookup, e.g. when a neighbor is added or removed, its
+ * reachability or link-layer address changes, or a route or prefix is added or
+ * removed. This includes changes done by lookups such as
+ * @ref gnrc_ipv6_nib_get_next_hop_l2addr() themselves, e.g. when they start
+ * address resolution. As long as the generation did not change, the result of
+ * a previous lookup is still valid, so users can cache results and compare the
+ * generation instead of asking the NIB again.
+ *
+ * @return  The current generation of the NIB.
+ */
+uint32_t gnrc_ipv6_nib_gen(void);
+
 /**
  * @brief   Handles a received ICMPv6 packet
  *
@@ -81,6 +81,14 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_DNS                      1
 #endif
 
+#ifdef MODULE_GNRC_IPV6_NIB_FT_TRIE
+#define CONFIG_GNRC_IPV6_NIB_FT_TRIE                  1
+#endif
+
+#ifdef MODULE_GNRC_IPV6_NIB_NC_HASH
+#define CONFIG_GNRC_IPV6_NIB_NC_HASH                  1
+#endif
+
 /**
  * @name    Compile flags
  * @brief   Compile flags to (de-)activate certain features for NIB
@@ -193,6 +201,30 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_DNS                      0
 #endif
 
+/**
+ * @brief   Index the off-link entries in a prefix trie
+ *
+ * Makes the longest-prefix match of the forwarding table independent of the
+ * number of routes at the cost of
+ * `(2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF - 1)` trie nodes of RAM. Without it
+ * all off-link entries are compared to the destination on each lookup.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_FT_TRIE
+#define CONFIG_GNRC_IPV6_NIB_FT_TRIE                  0
+#endif
+
+/**
+ * @brief   Index the on-link entries by their address in a hash table
+ *
+ * Makes looking up a neighbor independent of the number of on-link entries.
+ * Only creating an entry for a new neighbor still searches all of them.
+ * Additionally, neighbors confirmed reachable are moved to the end of the
+ * list of entries to be cached out when the neighbor cache is full.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_NC_HASH
+#define CONFIG_GNRC_IPV6_NIB_NC_HASH                  0
+#endif
+
 /**
  * @brief   Multihop prefix and 6LoWPAN context distribution
  *
@@ -261,6 +293,15 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_NUMOF                   (4)
 #endif
 
+/**
+ * @brief   Number of buckets of the on-link entry index as exponent of 2
+ *
+ * @note    Only used with @ref CONFIG_GNRC_IPV6_NIB_NC_HASH.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS_EXP
+#define CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS_EXP     (4U)
+#endif
+
 /**
  * @brief   Number of off-link entries in NIB
  *
@@ -93,6 +93,19 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for passing a train of received packets up the
+ *          network stack
+ *
+ * The packets of a train are chained via the gnrc_pktsnip_t::next pointer
+ * of their last snip, which is the netif header. Use gnrc_netapi_train_pop()
+ * to take them apart.
+ *
+ * @note    Only sent to @ref net_gnrc_ipv6 by interfaces with module
+ *          `gnrc_netif_rx_train`.
+ */
+#define GNRC_NETAPI_MSG_TYPE_RCV_TRAIN  (0x0207)
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -119,6 +132,29 @@ typedef struct {
  */
 int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type);
 
+/**
+ * @brief   Removes the first packet from a packet train
+ *
+ * @see     @ref GNRC_NETAPI_MSG_TYPE_RCV_TRAIN
+ *
+ * @param[in,out] train A packet train. Is set to the remaining train
+ *                      or NULL if it only contained one packet.
+ *
+ * @return  The first packet of @p train.
+ */
+static inline gnrc_pktsnip_t *gnrc_netapi_train_pop(gnrc_pktsnip_t **train)
+{
+    gnrc_pktsnip_t *pkt = *train;
+    gnrc_pktsnip_t *tail = pkt;
+
+    while ((tail->type != GNRC_NETTYPE_NETIF) && (tail->next != NULL)) {
+        tail = tail->next;
+    }
+    *train = tail->next;
+    tail->next = NULL;
+    return pkt;
+}
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_GET or
  *          @ref GNRC_NETAPI_MSG_TYPE_SET messages and parsing the returned
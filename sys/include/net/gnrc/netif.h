@@ -19,6 +19,17 @@
  * If you only have one network interface on the board, you can select the
  * `gnrc_netif_single` pseudo-module to enable further optimisations.
  *
+ * ## Packet trains
+ *
+ * With the `gnrc_netif_rx_train` pseudo-module an interface does not pass on
+ * each received IPv6 packet on its own. It collects the packets received in a
+ * row and passes them on to @ref net_gnrc_ipv6 with a single
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV_TRAIN message once it has nothing left to
+ * receive, or @ref CONFIG_GNRC_NETIF_RX_TRAIN_LEN packets were collected.
+ * Under burst load this saves a context switch per packet. If
+ * @ref net_gnrc_ipv6 is not the only receiver of IPv6 packets by then, the
+ * collected packets are dispatched one by one instead.
+ *
  * @{
  *
  * @file
@@ -182,6 +193,27 @@ typedef struct {
      * @note    Only available with @ref net_gnrc_netif_pktq.
      */
     gnrc_netif_pktq_t send_queue;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_TRAIN) || defined(DOXYGEN)
+    /**
+     * @brief   Received IPv6 packets not yet passed on to
+     *          @ref net_gnrc_ipv6
+     *
+     * @note    Only available with module `gnrc_netif_rx_train`.
+     */
+    gnrc_pktsnip_t *rx_train;
+    /**
+     * @brief   Last snip of the last packet in gnrc_netif_t::rx_train
+     *
+     * @note    Only available with module `gnrc_netif_rx_train`.
+     */
+    gnrc_pktsnip_t *rx_train_tail;
+    /**
+     * @brief   Number of packets in gnrc_netif_t::rx_train
+     *
+     * @note    Only available with module `gnrc_netif_rx_train`.
+     */
+    uint8_t rx_train_len;
 #endif
     uint8_t cur_hl;                         /**< Current hop-limit for out-going packets */
     uint8_t device_type;                    /**< Device type */
@@ -78,6 +78,19 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_PKTQ_TIMER_US       (5000U)
 #endif
 
+/**
+ * @brief       Maximum number of received IPv6 packets passed on to
+ *              @ref net_gnrc_ipv6 at once
+ *
+ * With module `gnrc_netif_rx_train` an interface collects the IPv6 packets it
+ * receives in a row and passes them on with a single
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV_TRAIN message as soon as it has nothing left
+ * to receive or this number of packets is reached.
+ */
+#ifndef CONFIG_GNRC_NETIF_RX_TRAIN_LEN
+#define CONFIG_GNRC_NETIF_RX_TRAIN_LEN        (8U)
+#endif
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
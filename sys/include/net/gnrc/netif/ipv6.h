@@ -70,6 +70,27 @@ extern "C" {
 #define GNRC_NETIF_IPV6_ADDRS_FLAGS_ANYCAST                (0x20U)
 /** @} */
 
+/**
+ * @brief   Number of unicast scopes source address candidates are grouped by
+ *
+ * @see gnrc_netif_ipv6_t::addrs_scopes
+ */
+#define GNRC_NETIF_IPV6_ADDRS_SCOPES_NUMOF                 (3U)
+
+/**
+ * @brief   Bitmask over gnrc_netif_ipv6_t::addrs, bit `i` standing for the
+ *          address at index `i`
+ */
+#if (CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF <= 8) || DOXYGEN
+typedef uint8_t gnrc_netif_ipv6_addrs_mask_t;
+#elif CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF <= 16
+typedef uint16_t gnrc_netif_ipv6_addrs_mask_t;
+#elif CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF <= 32
+typedef uint32_t gnrc_netif_ipv6_addrs_mask_t;
+#else
+#error "CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF must not exceed 32"
+#endif
+
 /**
  * @brief   IPv6 component for @ref gnrc_netif_t
  *
@@ -92,6 +113,26 @@ typedef struct {
      */
     ipv6_addr_t addrs[CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF];
 
+    /**
+     * @brief   Prefix lengths of gnrc_netif_ipv6_t::addrs
+     *
+     * Caps the longest matching prefix in source address selection.
+     *
+     * @note    Only available with module @ref net_gnrc_ipv6 "gnrc_ipv6".
+     */
+    uint8_t addrs_pfx_len[CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF];
+
+    /**
+     * @brief   Link-local, site-local, and global addresses (in that order)
+     *          in gnrc_netif_ipv6_t::addrs
+     *
+     * Kept up to date when addresses are added or removed, so source address
+     * selection does not need to look at the addresses to compare scopes.
+     *
+     * @note    Only available with module @ref net_gnrc_ipv6 "gnrc_ipv6".
+     */
+    gnrc_netif_ipv6_addrs_mask_t addrs_scopes[GNRC_NETIF_IPV6_ADDRS_SCOPES_NUMOF];
+
     /**
      * @brief   IPv6 multicast groups of the interface
      *
@@ -10,6 +10,13 @@
  * @defgroup    net_gnrc_netreg  Network protocol registry
  * @ingroup     net_gnrc
  * @brief       Registry to receive messages of a specified protocol type by GNRC.
+ *
+ * By default the registry keeps one list of entries per protocol type. With
+ * many entries of the same type, e.g. one per UDP port of a socket, each
+ * lookup scans all of them. With the `gnrc_netreg_hash` pseudo-module the
+ * entries are instead kept in a hash table indexed by protocol type and
+ * demultiplexing context, so a lookup only scans entries that collide in
+ * the same bucket.
  * @{
  *
  * @file
@@ -35,6 +42,17 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of buckets of the registry's hash table as exponent of 2
+ *
+ * Must be within [1, 16].
+ *
+ * @note    Only used with module `gnrc_netreg_hash`.
+ */
+#ifndef CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP
+#define CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP (4U)
+#endif
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
     defined(DOXYGEN)
 /**
@@ -79,6 +97,13 @@ typedef enum {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+#if defined(MODULE_GNRC_NETREG_HASH)
+/* gnrc_netreg_entry_t::nettype is set by gnrc_netreg_register() */
+#define _GNRC_NETREG_ENTRY_INIT_NETTYPE , GNRC_NETTYPE_UNDEF
+#else
+#define _GNRC_NETREG_ENTRY_INIT_NETTYPE
+#endif
+
 /**
  * @name    Static entry initialization macros
  * @anchor  net_gnrc_netreg_init_static
@@ -96,9 +121,11 @@ typedef enum {
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
-                                                      { pid } }
+                                                      { pid } \
+                                                      _GNRC_NETREG_ENTRY_INIT_NETTYPE }
 #else
-#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } }
+#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } \
+                                                      _GNRC_NETREG_ENTRY_INIT_NETTYPE }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -115,7 +142,8 @@ typedef enum {
  */
 #define GNRC_NETREG_ENTRY_INIT_MBOX(demux_ctx, _mbox) { NULL, demux_ctx, \
                                                        GNRC_NETREG_TYPE_MBOX, \
-                                                       { .mbox = _mbox } }
+                                                       { .mbox = _mbox } \
+                                                       _GNRC_NETREG_ENTRY_INIT_NETTYPE }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
@@ -132,7 +160,8 @@ typedef enum {
  */
 #define GNRC_NETREG_ENTRY_INIT_CB(demux_ctx, _cbd)   { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_CB, \
-                                                      { .cbd = _cbd } }
+                                                      { .cbd = _cbd } \
+                                                      _GNRC_NETREG_ENTRY_INIT_NETTYPE }
 /** @} */
 
 /**
@@ -210,6 +239,16 @@ typedef struct gnrc_netreg_entry {
         gnrc_netreg_entry_cbd_t *cbd;
 #endif
     } target;                   /**< Target for the registry entry */
+#if defined(MODULE_GNRC_NETREG_HASH) || defined(DOXYGEN)
+    /**
+     * @brief   Protocol type the entry is registered for
+     *
+     * @internal
+     *
+     * @note    Only available with module `gnrc_netreg_hash`.
+     */
+    gnrc_nettype_t nettype;
+#endif
 } gnrc_netreg_entry_t;
 
 /**
@@ -18,6 +18,17 @@
  *          this *will* lead to alignment problems and can potentially result
  *          in segmentation/hard faults and other unexpected behaviour.
  *
+ * The packet buffer is provided by one of the following modules:
+ *
+ * - `gnrc_pktbuf_static` (default): a static buffer of
+ *   @ref CONFIG_GNRC_PKTBUF_SIZE bytes, managed with a first-fit free list
+ * - `gnrc_pktbuf_malloc`: uses `malloc()` and `free()`
+ * - `gnrc_pktbuf_slab`: static pools of fixed size blocks for packet snip
+ *   descriptors and three size classes of data (see
+ *   @ref CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE and following). Allocation and
+ *   release take constant time and the buffer cannot fragment, at the price
+ *   of wasting the unused part of each block.
+ *
  * @{
  *
  * @file
@@ -62,6 +73,62 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Number of packet snip descriptors of `gnrc_pktbuf_slab`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SNIPS_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SNIPS_NUMOF     (32)
+#endif
+
+/**
+ * @brief   Size of the small data blocks of `gnrc_pktbuf_slab`
+ *
+ * @details Meant for headers, so it should fit an IPv6 header
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE      (64)
+#endif
+
+/**
+ * @brief   Number of small data blocks of `gnrc_pktbuf_slab`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF     (16)
+#endif
+
+/**
+ * @brief   Size of the medium data blocks of `gnrc_pktbuf_slab`
+ *
+ * @details Meant for link layer frames of low-power radios
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE     (256)
+#endif
+
+/**
+ * @brief   Number of medium data blocks of `gnrc_pktbuf_slab`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF    (8)
+#endif
+
+/**
+ * @brief   Size of the large data blocks of `gnrc_pktbuf_slab`
+ *
+ * @details This is the maximum size of a packet snip's data, so it should fit
+ *          a full Ethernet frame or a reassembled IPv6 packet
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE      (1536)
+#endif
+
+/**
+ * @brief   Number of large data blocks of `gnrc_pktbuf_slab`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF     (2)
+#endif
 /** @} */
 
 /**
@@ -93,6 +160,54 @@ void gnrc_pktbuf_init(void);
 gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
                                 gnrc_nettype_t type);
 
+/**
+ * @brief   Loans a buffer from the packet buffer for a network device to
+ *          receive a frame into.
+ *
+ * The buffer is placed so that the link-layer header of @p hdr_size bytes
+ * at its beginning can later be split off by gnrc_pktbuf_commit() without
+ * moving the rest of the frame. This way the received frame is only
+ * touched once: when the driver writes it into gnrc_pktsnip_t::data of the
+ * result.
+ *
+ * The largest buffer that can be loaned depends on the backend: with
+ * `gnrc_pktbuf_static` @p size plus the padding that aligns the data after
+ * the link-layer header must not exceed @ref CONFIG_GNRC_PKTBUF_SIZE, with
+ * `gnrc_pktbuf_slab` @p size must not exceed
+ * @ref CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE.
+ *
+ * @param[in] size      Maximum size of the frame to receive.
+ * @param[in] hdr_size  Size of the link-layer header of the frame.
+ *
+ * @return  A packet snip of type @ref GNRC_NETTYPE_UNDEF with @p size bytes
+ *          of data.
+ * @return  NULL, if @p size exceeds the largest buffer the backend provides
+ *          or no space is left in the packet buffer.
+ */
+gnrc_pktsnip_t *gnrc_pktbuf_loan(size_t size, size_t hdr_size);
+
+/**
+ * @brief   Commits a frame received into a buffer loaned by
+ *          gnrc_pktbuf_loan().
+ *
+ * Shrinks @p pkt to the @p size bytes actually received and marks the
+ * link-layer header at its beginning, like gnrc_pktbuf_mark() does.
+ *
+ * @pre @p pkt was returned by `gnrc_pktbuf_loan(n, hdr_size)` with `n >= size`
+ *
+ * @param[in] pkt       A loaned packet snip.
+ * @param[in] size      Number of bytes received into @p pkt.
+ * @param[in] hdr_size  Size of the link-layer header. Must be the same as
+ *                      given to gnrc_pktbuf_loan().
+ * @param[in] type      The type of the header snip.
+ *
+ * @return  The header snip in @p pkt on success.
+ * @return  NULL, if `size <= hdr_size` or if no space is left in the
+ *          packet buffer.
+ */
+gnrc_pktsnip_t *gnrc_pktbuf_commit(gnrc_pktsnip_t *pkt, size_t size,
+                                   size_t hdr_size, gnrc_nettype_t type);
+
 /**
  * @brief   Marks the first @p size bytes in a received packet with a new
  *          packet snip that is appended to the packet.
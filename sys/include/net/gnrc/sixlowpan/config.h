@@ -30,10 +30,19 @@ extern "C" {
 
 /**
  * @brief   Default stack size to use for the 6LoWPAN thread.
+ *
+ * With [gnrc_sixlowpan_iphc](@ref net_gnrc_sixlowpan_iphc), this includes
+ * the buffer of @ref CONFIG_GNRC_SIXLOWPAN_IPHC_HDRS_BUF_SIZE bytes the
+ * headers of unfragmented datagrams are decoded to.
  */
 #ifndef GNRC_SIXLOWPAN_STACK_SIZE
+#if defined(MODULE_GNRC_SIXLOWPAN_IPHC) || defined(DOXYGEN)
+#define GNRC_SIXLOWPAN_STACK_SIZE           (THREAD_STACKSIZE_DEFAULT + \
+                                             CONFIG_GNRC_SIXLOWPAN_IPHC_HDRS_BUF_SIZE)
+#else
 #define GNRC_SIXLOWPAN_STACK_SIZE           (THREAD_STACKSIZE_DEFAULT)
 #endif
+#endif
 
 /**
  * @brief   Default priority for the 6LoWPAN thread.
@@ -161,6 +170,25 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US  (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US */
 
+/**
+ * @brief   Size of the buffer the headers of an unfragmented datagram are
+ *          decoded to
+ *
+ * The headers are decoded on the stack first and then copied in place of the
+ * compressed headers in the received packet, so no additional packet buffer
+ * space needs to be allocated for them. The default fits an IPv6 header, a
+ * hop-by-hop options header and a UDP header. If the uncompressed headers
+ * (IPv6 header and extension headers, encapsulated IPv6 headers and the UDP
+ * header) of an unfragmented datagram are larger, they are decoded into a
+ * newly allocated snip instead.
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_iphc](@ref net_gnrc_sixlowpan_iphc) module.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_HDRS_BUF_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_HDRS_BUF_SIZE   (64U)
+#endif
+
 /**
  * @name Selective fragment recovery configuration
  * @see  [draft-ietf-6lo-fragment-recovery-07, section 7.1]
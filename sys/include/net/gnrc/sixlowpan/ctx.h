@@ -67,6 +67,9 @@ typedef struct {
     /**
      * @brief   Lifetime in minutes this context is valid.
      *
+     * @details Counted down every minute. When it reaches 0, the context is
+     *          not used for compression anymore.
+     *
      * @see     <a href="http://tools.ietf.org/html/rfc6775#section-4.2">
      *              6LoWPAN Context Option
      *          </a>
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_sixlowpan_frag_minfwd  Minimal fragment forwarding
+ * @ingroup     net_gnrc_sixlowpan_frag
+ * @brief       Forwards fragments of a datagram without reassembling it
+ *
+ * With this module, a 6LoWPAN router that created a
+ * @ref net_gnrc_sixlowpan_frag_vrb "virtual reassembly buffer" entry for the
+ * first fragment of a datagram forwards all following fragments of that
+ * datagram as they arrive. Subsequent fragments are only relabelled with the
+ * outgoing datagram tag and link-layer destination in the packet buffer they
+ * were received in, their payload is neither copied nor touched.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Minimal fragment forwarding definitions
+ * @see         https://tools.ietf.org/html/draft-ietf-lwig-6lowpan-virtual-reassembly-01
+ */
+#ifndef NET_GNRC_SIXLOWPAN_FRAG_MINFWD_H
+#define NET_GNRC_SIXLOWPAN_FRAG_MINFWD_H
+
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Forwards a subsequent fragment according to a VRB entry
+ *
+ * The fragment header is relabelled with
+ * gnrc_sixlowpan_frag_vrb_t::out_tag and the netif header is rewritten for
+ * gnrc_sixlowpan_frag_vrb_t::out_netif and the link-layer destination of
+ * @p vrbe. Both is done in place, if @p pkt is not shared with another user.
+ *
+ * @pre `vrbe != NULL`
+ * @pre `pkt != NULL`
+ * @pre `pkt->next` is the netif header of the received fragment.
+ *
+ * @param[in] pkt   A received subsequent fragment, starting with its
+ *                  fragmentation header. Released in any case.
+ * @param[in] vrbe  The VRB entry of the datagram of @p pkt.
+ * @param[in] page  Current 6Lo dispatch parsing page.
+ *
+ * @return  0 on success.
+ * @return  -ENOMEM, when the packet buffer is full.
+ * @return  -EMSGSIZE, when @p pkt does not fit into a frame of
+ *          gnrc_sixlowpan_frag_vrb_t::out_netif.
+ */
+int gnrc_sixlowpan_frag_minfwd_forward(gnrc_pktsnip_t *pkt,
+                                       gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                       unsigned page);
+
+/**
+ * @brief   Sends the recompressed first fragment of a datagram according to a
+ *          VRB entry
+ *
+ * @pre `vrbe != NULL`
+ * @pre `pkt != NULL`
+ * @pre `pkt->type == GNRC_NETTYPE_NETIF`
+ *
+ * @param[in] pkt   The netif header for the next hop, followed by the
+ *                  recompressed headers and the payload of the first
+ *                  fragment. Released in any case.
+ * @param[in] vrbe  The VRB entry of the datagram of @p pkt.
+ * @param[in] page  Current 6Lo dispatch parsing page.
+ *
+ * @return  0 on success.
+ * @return  -ENOMEM, when the packet buffer is full.
+ * @return  -EMSGSIZE, when the recompressed fragment does not fit into a
+ *          frame of gnrc_sixlowpan_frag_vrb_t::out_netif.
+ */
+int gnrc_sixlowpan_frag_minfwd_frag_iphc(gnrc_pktsnip_t *pkt,
+                                         gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                         unsigned page);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_FRAG_MINFWD_H */
+/** @} */
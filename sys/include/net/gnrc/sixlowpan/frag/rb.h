@@ -22,7 +22,9 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
+#include "bitfield.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pkt.h"
 
@@ -36,6 +38,27 @@ extern "C" {
  */
 #define GNRC_SIXLOWPAN_FRAG_RB_GC_MSG       (0x0226)
 
+/**
+ * @brief   Size of the blocks the reception of a datagram is tracked in in
+ *          bytes
+ *
+ * Fragment offsets are given in units of 8 octets, so a fragment always
+ * starts at a block boundary.
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc4944#section-5.3">
+ *          RFC 4944, section 5.3
+ *      </a>
+ */
+#define GNRC_SIXLOWPAN_FRAG_RB_BLOCK_SIZE   (8U)
+
+/**
+ * @brief   Number of blocks of the largest possible datagram
+ *
+ * The datagram size field of the fragmentation header is 11 bits long.
+ */
+#define GNRC_SIXLOWPAN_FRAG_RB_BLOCKS_NUMOF (2048U / \
+                                             GNRC_SIXLOWPAN_FRAG_RB_BLOCK_SIZE)
+
 /**
  * @brief   Fragment intervals to identify limits of fragments and duplicates.
  *
@@ -96,6 +119,14 @@ typedef struct {
      * @brief   The reassembled packet in the packet buffer
      */
     gnrc_pktsnip_t *pkt;
+    /**
+     * @brief   Blocks of the datagram already received
+     *
+     * Covers the same bytes as gnrc_sixlowpan_frag_rb_base_t::ints, so new
+     * fragments only need to be compared to the intervals when they hit a
+     * received block.
+     */
+    BITFIELD(received, GNRC_SIXLOWPAN_FRAG_RB_BLOCKS_NUMOF);
 } gnrc_sixlowpan_frag_rb_t;
 
 /**
@@ -229,7 +260,8 @@ int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf
  *
  * @pre `rbuf != NULL`
  *
- * This functions sets rbuf_t::super::pkt to NULL and removes all rbuf::ints.
+ * This functions sets rbuf_t::super::pkt to NULL and removes all rbuf::ints
+ * and rbuf::received blocks.
  *
  * @note    Does nothing if module `gnrc_sixlowpan_frag_rb` is not included.
  *
@@ -240,6 +272,7 @@ static inline void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf)
     assert(rbuf != NULL);
     gnrc_sixlowpan_frag_rb_base_rm(&rbuf->super);
     rbuf->pkt = NULL;
+    memset(rbuf->received, 0, sizeof(rbuf->received));
 }
 #else
 /* NOPs to be used with gnrc_sixlowpan_iphc if gnrc_sixlowpan_frag_rb is not
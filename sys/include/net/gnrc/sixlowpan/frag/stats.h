@@ -41,6 +41,9 @@ typedef struct {
     unsigned vrb_full;      /**< counts the number of events where the virtual
                              *   reassembly buffer is full */
 #endif
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) || DOXYGEN
+    unsigned fwd_fragments; /**< fragments forwarded without reassembly */
+#endif
 } gnrc_sixlowpan_frag_stats_t;
 
 /**
@@ -101,6 +101,28 @@ int gnrc_tcp_init(void);
  */
 void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Use a receive buffer of the caller instead of a preallocated one.
+ *
+ * The window advertised to the peer grows with the buffer. Buffers larger
+ * than 64 KiB are announced with the window scale option (see RFC 7323),
+ * if the peer supports it. The buffer is used for all following connections
+ * of @p tcb until gnrc_tcp_tcb_init() is called.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ * @pre @p buf must not be NULL.
+ *
+ * @param[in,out] tcb    TCB the receive buffer is used for.
+ * @param[in]     buf    Receive buffer, must stay valid while it is used.
+ * @param[in]     size   Size of @p buf in bytes.
+ *
+ * @return   Zero on success.
+ * @return   -EINVAL if @p size is zero.
+ * @return   -EISCONN if @p tcb is already in use.
+ */
+int gnrc_tcp_tcb_set_rcv_buf(gnrc_tcp_tcb_t *tcb, void *buf, size_t size);
+
 /**
  * @brief Opens a connection actively.
  *
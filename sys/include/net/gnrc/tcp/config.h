@@ -108,6 +108,18 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Number of segments received out of order kept per connection
+ *
+ * Segments arriving behind a gap in the sequence space are kept in the packet
+ * buffer until the gap is filled, instead of being dropped and sent again by
+ * the peer. The kept segments are reported to the peer with selective
+ * acknowledgments (SACK, see RFC 2018). 0 disables both.
+ */
+#ifndef CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+#define CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS (0U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
@@ -55,14 +55,16 @@ typedef struct _transmission_control_block {
     uint8_t status;        /**< A connections status flags */
     uint32_t snd_una;      /**< Send unacknowledged */
     uint32_t snd_nxt;      /**< Send next */
-    uint16_t snd_wnd;      /**< Send window */
+    uint32_t snd_wnd;      /**< Send window */
     uint32_t snd_wl1;      /**< SeqNo. from last window update */
     uint32_t snd_wl2;      /**< AckNo. from last window update */
     uint32_t rcv_nxt;      /**< Receive next */
-    uint16_t rcv_wnd;      /**< Receive window */
+    uint32_t rcv_wnd;      /**< Receive window */
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
+    uint8_t snd_wnd_scale; /**< Shift count of windows received from the peer */
+    uint8_t rcv_wnd_scale; /**< Shift count of windows sent to the peer */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
@@ -74,6 +76,12 @@ typedef struct _transmission_control_block {
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+    /**
+     * @brief Segments received out of order, most recently received first
+     */
+    gnrc_pktsnip_t *rcv_ooo[CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS];
+#endif
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
     struct _transmission_control_block *next;   /**< Pointer next TCB */
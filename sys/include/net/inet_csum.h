@@ -73,6 +73,24 @@ static inline uint16_t inet_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
     return inet_csum_slice(sum, buf, len, 0);
 }
 
+/**
+ * @brief   Architecture specific summation of the 16-bit words in a buffer
+ *
+ * @details inet_csum_slice() accumulates full machine words in C. A 32-bit
+ *          CPU with a faster way (e.g. SIMD instructions or an add-with-carry
+ *          loop) defines `INET_CSUM_HAS_ARCH` in its `cpu_conf.h` and
+ *          implements this function, which is then used for the bulk of the
+ *          buffer instead.
+ *
+ * @param[in] buf       A buffer, aligned to 32 bits.
+ * @param[in] len       Length of @p buf in byte, a multiple of 4.
+ *
+ * @return  The one's complement sum of the 16-bit words in @p buf in host byte
+ *          order, folded to 32 bits (i. e. all carries out of bit 31 added
+ *          back in).
+ */
+uint32_t inet_csum_arch(const uint8_t *buf, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -49,6 +49,9 @@ typedef struct {
                                      sending operation, e.g. multicast) */
     uint32_t tx_failed;         /**< failed sending operations */
     uint32_t tx_bytes;          /**< sent bytes */
+    uint32_t tx_copied_bytes;   /**< sent bytes that were copied out of the
+                                     original packet, e.g. into 6LoWPAN
+                                     fragments */
     uint32_t rx_count;          /**< received (data) packets */
     uint32_t rx_bytes;          /**< received bytes */
 } netstats_t;
@@ -32,6 +32,16 @@ extern "C" {
  */
 void ps(void);
 
+/**
+ * @brief Print information to all active threads to stdout in a machine
+ *        readable format.
+ *
+ * One JSON object is printed per line and thread. If the module
+ * `schedstatistics` is used, the scheduler statistics of each thread and the
+ * time spent in interrupt handlers are included.
+ */
+void ps_json(void);
+
 #ifdef __cplusplus
 }
 #endif
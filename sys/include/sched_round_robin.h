@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_round_robin Round Robin Scheduler
+ * @ingroup     sys
+ * @brief       Time slicing for threads of equal priority
+ *
+ * RIOT's scheduler only switches between threads of the same priority when
+ * the running thread blocks or yields. This module adds optional time
+ * slicing on top of it: if more than one thread is runnable at the priority
+ * of the running thread, a ztimer is armed that moves the running thread to
+ * the end of its runqueue after @ref SCHED_RR_TIMEOUT.
+ *
+ * The timer is only armed while the active priority has more than one
+ * runnable thread, so the tickless behavior of the scheduler is retained
+ * whenever there is nothing to slice.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Round robin time slicing for threads of equal priority
+ */
+
+#ifndef SCHED_ROUND_ROBIN_H
+#define SCHED_ROUND_ROBIN_H
+
+#include <stdint.h>
+
+#include "sched.h"
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   ztimer clock used for the time slices
+ */
+#ifndef SCHED_RR_TIMERBASE
+#define SCHED_RR_TIMERBASE      ZTIMER_USEC
+#endif
+
+/**
+ * @brief   Length of a time slice in ticks of @ref SCHED_RR_TIMERBASE
+ */
+#ifndef SCHED_RR_TIMEOUT
+#define SCHED_RR_TIMEOUT        (10000U)
+#endif
+
+/**
+ * @brief   Bitmask of priorities excluded from time slicing
+ *
+ * Bit `n` set means threads of priority `n` are never preempted in favour of
+ * threads of the same priority. By default only the idle priority is
+ * excluded.
+ */
+#ifndef SCHED_RR_MASK
+#define SCHED_RR_MASK           (1UL << (SCHED_PRIO_LEVELS - 1))
+#endif
+
+/**
+ * @brief   Initialize round robin time slicing
+ *
+ * Called by auto_init if enabled.
+ */
+void sched_round_robin_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_ROUND_ROBIN_H */
+/** @} */
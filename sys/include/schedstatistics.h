@@ -14,8 +14,23 @@
  *              (@ref schedstat_t) for a thread will be updated on every
  *              @ref sched_run().
  *
+ * All times are measured in microseconds using `ZTIMER_USEC`. For every
+ * thread the module keeps track of
+ *
+ * - the time it was running (excluding time spent in interrupt handlers, as
+ *   far as the CPU reports them, see @ref sched_statistics_isr_enter()),
+ * - how often it was scheduled, and how often it was switched out because it
+ *   blocked (voluntary) or while it was still runnable (involuntary), and
+ * - a histogram of its wakeup-to-run latency, i.e. the time between the thread
+ *   becoming runnable and the thread actually being scheduled.
+ *
+ * The time spent in interrupt handlers is accounted for separately in
+ * @ref sched_isrstat. Currently only `native` reports its interrupt handlers;
+ * on all other CPUs @ref sched_isrstat stays zero and interrupt time is
+ * accounted to the interrupted thread.
+ *
  * @note        If auto_init is disabled `init_schedstatistics()` needs to be
- *              called as well as xtimer_init().
+ *              called as well as ztimer_init().
  * @{
  *
  * @file
@@ -36,6 +51,30 @@
  extern "C" {
 #endif
 
+/**
+ * @defgroup schedstatistics_config Schedstatistics compile configurations
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Number of buckets of the wakeup latency histogram
+ *
+ * Bucket 0 counts latencies below 2^@ref CONFIG_SCHEDSTATISTICS_LATENCY_SHIFT
+ * microseconds, each following bucket covers twice the range of its
+ * predecessor. The last bucket counts all remaining latencies.
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS
+#define CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS  8
+#endif
+
+/**
+ * @brief   Log2 of the upper bound of the first latency bucket in microseconds
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_LATENCY_SHIFT
+#define CONFIG_SCHEDSTATISTICS_LATENCY_SHIFT    4
+#endif
+/** @} */
+
 /**
  *  Scheduler statistics
  */
@@ -43,20 +82,85 @@ typedef struct {
     uint32_t laststart;      /**< Time stamp of the last time this thread was
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
-    uint64_t runtime_ticks;  /**< The total runtime of this thread in ticks */
+    uint64_t runtime_us;     /**< The total runtime of this thread in us */
+    unsigned int voluntary;  /**< How often the thread was switched out
+                                  because it blocked */
+    unsigned int involuntary; /**< How often the thread was switched out
+                                   while still being runnable */
+    uint32_t wakeup;         /**< Time stamp of the last time this thread
+                                  became runnable */
+    uint32_t latency_max;    /**< Maximum wakeup-to-run latency in us */
+    unsigned int latency[CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS]; /**<
+                                  Histogram of the wakeup-to-run latency */
+    uint8_t woken;           /**< Thread became runnable, but was not
+                                  scheduled yet */
 } schedstat_t;
 
+/**
+ *  Interrupt statistics
+ */
+typedef struct {
+    uint32_t laststart;      /**< Time stamp of the last interrupt entry */
+    unsigned int count;      /**< Number of (non-nested) interrupts */
+    uint64_t runtime_us;     /**< The total time spent in interrupts in us */
+    uint8_t nesting;         /**< Current interrupt nesting level */
+} schedstat_isr_t;
+
 /**
  *  Thread statistics table
  */
 extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+/**
+ *  Interrupt statistics
+ *
+ *  @note   Only populated on `native`, see @ref sched_statistics_isr_enter()
+ */
+extern schedstat_isr_t sched_isrstat;
+
 /**
  *  @brief  Registers the sched statistics callback and sets laststart for
  *          caller thread
  */
 void init_schedstatistics(void);
 
+/**
+ * @brief   Get the upper bound (exclusive) of a latency histogram bucket
+ *
+ * @param[in]   bucket  index of the bucket
+ *
+ * @return  upper bound of @p bucket in microseconds,
+ * @return  UINT32_MAX for the last bucket
+ */
+static inline uint32_t sched_statistics_latency_bound(unsigned bucket)
+{
+    if (bucket >= CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS - 1) {
+        return UINT32_MAX;
+    }
+    return 1UL << (CONFIG_SCHEDSTATISTICS_LATENCY_SHIFT + bucket);
+}
+
+/**
+ * @brief   Mark the entry of an interrupt handler
+ *
+ * Time spent between this call and the matching call to
+ * @ref sched_statistics_isr_exit() is not accounted to the interrupted
+ * thread, but to @ref sched_isrstat instead. Nested calls are allowed.
+ *
+ * @note    Meant to be called by the CPU's common interrupt entry code with
+ *          interrupts disabled. Only `native` calls it so far, as e.g.
+ *          Cortex-M dispatches interrupts straight from the vector table
+ *          without a common entry point.
+ */
+void sched_statistics_isr_enter(void);
+
+/**
+ * @brief   Mark the exit of an interrupt handler
+ *
+ * @see     sched_statistics_isr_enter()
+ */
+void sched_statistics_isr_exit(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -140,6 +140,29 @@
  * to be shown whether the increased complexity would lead to better
  * performance for any reasonable amount of active timers.
  *
+ * Timers that do not need an exact deadline can be set using
+ * ztimer_set_with_slack(). Such a timer is aligned with the first other timer
+ * of the clock that is due within the given slack, so that both are handled in
+ * the same interrupt. With `ztimer_wheel`, timers in the wheel are only taken
+ * into account if they are in a slot that the start or the end of the slack
+ * window falls into.
+ *
+ * For systems with many (hundreds of) concurrently active timers, the module
+ * `ztimer_wheel` adds a hierarchical timing wheel to every clock: timers due at
+ * least one wheel slot (2^@ref CONFIG_ZTIMER_WHEEL_SHIFT ticks) in the future
+ * are put into a slot of the wheel in O(1). Each wheel level has
+ * @ref ZTIMER_WHEEL_SLOTS slots, every level's slots being
+ * @ref ZTIMER_WHEEL_SLOTS times as wide as the ones of the level below. An
+ * internal timer kept in the sorted list moves the timers of a slot one level
+ * down or into the list once the slot's time has come. Thus the list only
+ * holds timers due within the next two slots, and the timers are triggered in
+ * the same order and with the same offset compensation as without the wheel:
+ * timers are appended to their slot and moved down in that order, so timers
+ * due at the same time fire in the order they were set. The slot lists are
+ * doubly linked, so removing a timer from the wheel is O(1) as well. The wheel
+ * needs about @ref CONFIG_ZTIMER_WHEEL_LEVELS * @ref ZTIMER_WHEEL_SLOTS
+ * pointers of RAM per clock and one more pointer per timer.
+ *
  *
  * ## Clock extension
  *
@@ -262,6 +285,10 @@ typedef struct ztimer_clock ztimer_clock_t;
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
     uint32_t offset;            /**< offset from last timer in list */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_base_t *prev;        /**< previous timer in wheel slot, NULL if the
+                                     timer is not in the wheel */
+#endif
 };
 
 #if MODULE_ZTIMER_NOW64
@@ -306,6 +333,41 @@ typedef struct {
     void (*cancel)(ztimer_clock_t *clock);
 } ztimer_ops_t;
 
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+/**
+ * @brief   log2 of the width of the lowest level wheel slots in clock ticks
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_SHIFT
+#define CONFIG_ZTIMER_WHEEL_SHIFT   (10U)
+#endif
+
+/**
+ * @brief   Number of levels of the timing wheel
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_LEVELS
+#define CONFIG_ZTIMER_WHEEL_LEVELS  (3U)
+#endif
+
+/**
+ * @brief   Number of slots per timing wheel level
+ */
+#define ZTIMER_WHEEL_SLOTS          (32U)
+
+/**
+ * @brief   Timing wheel of a clock
+ */
+typedef struct {
+    ztimer_base_t *slots[CONFIG_ZTIMER_WHEEL_LEVELS][ZTIMER_WHEEL_SLOTS]; /**<
+                                         last timer of each slot's circular
+                                         list                               */
+    uint32_t bitmap[CONFIG_ZTIMER_WHEEL_LEVELS]; /**< non-empty slots       */
+    ztimer_t timer;                 /**< timer processing the next slot     */
+    uint32_t pos;                   /**< time of the last processed slot    */
+    uint32_t next;                  /**< time of the next slot to process   */
+    uint8_t armed;                  /**< timer is set                       */
+} ztimer_wheel_t;
+#endif
+
 /**
  * @brief   ztimer device structure
  */
@@ -325,6 +387,17 @@ struct ztimer_clock {
 #if MODULE_PM_LAYERED || DOXYGEN
     uint8_t required_pm_mode;       /**< min. pm mode required for the clock to run */
 #endif
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_wheel_t wheel;           /**< timing wheel for far timers        */
+#endif
+#if MODULE_ZTIMER_OVERHEAD || DOXYGEN
+    uint32_t wakeups;               /**< number of handled interrupts       */
+#endif
+#if MODULE_ZTIMER_EPOCH || DOXYGEN
+    uint32_t epoch;                 /**< upper 32 bit of ztimer_now64()     */
+    uint32_t epoch_last;            /**< lower 32 bit at last ztimer_now64() */
+    ztimer_t epoch_timer;           /**< reads the time every 2^31 ticks    */
+#endif
 };
 
 /**
@@ -348,6 +421,30 @@ void ztimer_handler(ztimer_clock_t *clock);
  */
 void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
 
+/**
+ * @brief   Set a timer on a clock, allowing it to trigger late
+ *
+ * Like @ref ztimer_set(), but @p timer may trigger up to @p slack ticks after
+ * @p val. If another timer of @p clock is due within that window, @p timer is
+ * set to trigger together with it, saving a separate wakeup. This is meant for
+ * timeouts that do not need an exact deadline, e.g. periodic polling.
+ *
+ * Only timers already set on the clock are considered, so the timers with
+ * the least slack should be set first.
+ *
+ * @note The memory pointed to by @p timer is not copied and must
+ *       remain in scope until the callback is fired or the timer
+ *       is removed via @ref ztimer_remove
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   timer       timer entry to set
+ * @param[in]   val         earliest timer target (relative ticks from now)
+ * @param[in]   slack       maximum number of ticks the timer may trigger
+ *                          after @p val
+ */
+void ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                           uint32_t val, uint32_t slack);
+
 /**
  * @brief   Remove a timer from a clock
  *
@@ -435,6 +532,48 @@ static inline ztimer_now_t ztimer_now(ztimer_clock_t *clock)
     }
 }
 
+#if MODULE_ZTIMER_EPOCH || DOXYGEN
+/**
+ * @brief ztimer_now64() for the epoch extension
+ *
+ * @internal
+ *
+ * @param[in]   clock          ztimer clock to operate on
+ * @return  Current 64 bit count on the clock @p clock
+ */
+uint64_t _ztimer_now64_epoch(ztimer_clock_t *clock);
+#endif
+
+#if MODULE_ZTIMER_EPOCH || MODULE_ZTIMER_NOW64 || DOXYGEN
+/**
+ * @brief   Get the current time from a clock as monotonic 64 bit value
+ *
+ * With the module `ztimer_now64`, this is the same as ztimer_now(). Otherwise,
+ * the module `ztimer_epoch` counts the wraparounds of the 32 bit ztimer_now()
+ * in the upper 32 bit. Unlike `ztimer_now64`, this does not make every
+ * ztimer_now() call of every clock checkpoint a 64 bit value, so only the
+ * callers of this function pay for the extension.
+ *
+ * @note    With `ztimer_epoch`, the first call on a clock sets a timer
+ *          that reads the clock every 2^31 ticks, so that no wraparound
+ *          is missed. Wraparounds before the first call are not counted.
+ *          For @ref ZTIMER_USEC that timer is set on @ref ZTIMER_MSEC if
+ *          available, so it does not block the power mode of ZTIMER_USEC.
+ *
+ * @param[in]   clock          ztimer clock to operate on
+ *
+ * @return  Current count on @p clock
+ */
+static inline uint64_t ztimer_now64(ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_NOW64
+    return ztimer_now(clock);
+#else
+    return _ztimer_now64_epoch(clock);
+#endif
+}
+#endif
+
 /**
  * @brief Suspend the calling thread until the time (@p last_wakeup + @p period)
  *
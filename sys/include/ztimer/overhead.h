@@ -43,5 +43,18 @@ extern "C" {
  */
 int32_t ztimer_overhead(ztimer_clock_t *clock, uint32_t base);
 
+/**
+ * @brief   Count the interrupts of a clock
+ *
+ * This function busy waits for @p duration ticks and returns the number of
+ * times the handler of @p clock was called in the meantime. This can be used
+ * to measure the wakeups saved by ztimer_set_with_slack().
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   duration    ticks to count the interrupts for
+ * @return  number of interrupts of @p clock within @p duration ticks
+ */
+uint32_t ztimer_overhead_wakeups(ztimer_clock_t *clock, uint32_t duration);
+
 #endif /* ZTIMER_OVERHEAD_H */
 /** @} */
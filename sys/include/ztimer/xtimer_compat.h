@@ -52,7 +52,7 @@ static inline xtimer_ticks32_t xtimer_now(void)
 
 static inline xtimer_ticks64_t xtimer_now64(void)
 {
-    return ztimer_now(ZTIMER_USEC);
+    return ztimer_now64(ZTIMER_USEC);
 }
 
 /*static void xtimer_now_timex(timex_t *out) {
@@ -65,7 +65,7 @@ static inline uint32_t xtimer_now_usec(void)
 
 static inline uint64_t xtimer_now_usec64(void)
 {
-    return ztimer_now(ZTIMER_USEC);
+    return ztimer_now64(ZTIMER_USEC);
 }
 
 static inline void _ztimer_sleep_scale(ztimer_clock_t *clock, uint32_t time, uint32_t scale)
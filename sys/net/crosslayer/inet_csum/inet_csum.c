@@ -14,12 +14,105 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
+
+#include "architecture.h"
+#include "byteorder.h"
+#include "cpu_conf.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* widest word the one's complement sum is accumulated in, needs to be a
+ * multiple of 16 bits */
+#if ARCHITECTURE_WORD_BITS == 32
+typedef uint32_t _csum_word_t;
+#else
+typedef uint16_t _csum_word_t;
+#endif
+
+/* one's complement addition: the carry is added back in */
+static inline _csum_word_t _add(_csum_word_t a, _csum_word_t b)
+{
+    a += b;
+    return a + (a < b);
+}
+
+static inline uint16_t _fold(uint32_t sum)
+{
+    sum = (sum & 0xffff) + (sum >> 16);
+    return (sum & 0xffff) + (sum >> 16);
+}
+
+/**
+ * @brief   Sums the 16-bit words in @p buf in host byte order a full word at a
+ *          time
+ *
+ * @pre @p buf is aligned to 16 bits
+ *
+ * If @p len is odd, the last byte is padded with zero to a 16-bit word.
+ */
+static uint16_t _sum_host(const uint8_t *buf, size_t len)
+{
+    _csum_word_t sum = 0;
+    uint16_t tmp;
+
+    if ((sizeof(_csum_word_t) > sizeof(uint16_t)) &&
+        ((uintptr_t)buf & (sizeof(_csum_word_t) - 1)) && (len >= 2)) {
+        /* align to _csum_word_t */
+        memcpy(&tmp, buf, sizeof(tmp));
+        sum = tmp;
+        buf += sizeof(tmp);
+        len -= sizeof(tmp);
+    }
+#if (ARCHITECTURE_WORD_BITS == 32) && defined(INET_CSUM_HAS_ARCH)
+    size_t words_len = len & ~(sizeof(_csum_word_t) - 1);
+
+    sum = _add(sum, inet_csum_arch(buf, words_len));
+    buf += words_len;
+    len -= words_len;
+#else
+    for (; len >= sizeof(_csum_word_t); buf += sizeof(_csum_word_t),
+                                        len -= sizeof(_csum_word_t)) {
+        _csum_word_t word;
+
+        memcpy(&word, __builtin_assume_aligned(buf, sizeof(word)),
+               sizeof(word));
+        sum = _add(sum, word);
+    }
+#endif
+    for (; len >= sizeof(tmp); buf += sizeof(tmp), len -= sizeof(tmp)) {
+        memcpy(&tmp, buf, sizeof(tmp));
+        sum = _add(sum, tmp);
+    }
+    if (len > 0) {
+        const uint8_t last[] = { *buf, 0 };
+
+        memcpy(&tmp, last, sizeof(tmp));
+        sum = _add(sum, tmp);
+    }
+    return _fold(sum);
+}
+
+/* sum of the big-endian 16-bit words in buf, the last byte is padded with zero
+ * to a 16-bit word if len is odd */
+static uint16_t _sum(const uint8_t *buf, size_t len)
+{
+    if ((uintptr_t)buf & 1) {
+        if (len == 0) {
+            return 0;
+        }
+        /* the one's complement sum is byte order independent, so the sum of
+         * the words starting at the aligned buf + 1 is the sum we look for
+         * with its bytes swapped (see RFC 1071, section 2 (B)) */
+        return _fold((uint32_t)(buf[0] << 8) +
+                     byteorder_swaps(ntohs(_sum_host(buf + 1, len - 1))));
+    }
+    return ntohs(_sum_host(buf, len));
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -42,21 +135,11 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         csum += *buf;         /* add first byte as bottom half of 16-byte word */
         buf++;
         len--;
-        accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
-
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
-
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
-    }
+    /* group bytes by 16-byte words and add them, if the length is odd the
+     * last byte is added as top half of a 16-byte word */
+    csum = _fold(csum + _sum(buf, len));
 
     DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
 
@@ -173,9 +173,8 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
     gnrc_pktsnip_t *pkt = NULL;
 
     if (bytes_expected > 0) {
-        pkt = gnrc_pktbuf_add(NULL, NULL,
-                              bytes_expected,
-                              GNRC_NETTYPE_UNDEF);
+        /* let the device read the frame directly into the packet buffer */
+        pkt = gnrc_pktbuf_loan(bytes_expected, sizeof(ethernet_hdr_t));
 
         if (!pkt) {
             DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
@@ -196,22 +195,16 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         netif->stats.rx_bytes += nread;
 #endif
 
-        if (nread < bytes_expected) {
-            /* we've got less than the expected packet size,
-             * so free the unused space.*/
-
-            DEBUG("gnrc_netif_ethernet: reallocating.\n");
-            gnrc_pktbuf_realloc_data(pkt, nread);
-        }
-
         DEBUG("gnrc_netif_ethernet: received packet from %s of length %d\n",
               gnrc_netif_addr_to_str(pkt->data, ETHERNET_ADDR_LEN, addr_str),
               nread);
 #if defined(MODULE_OD) && ENABLE_DEBUG
         od_hex_dump(pkt->data, nread, OD_WIDTH_DEFAULT);
 #endif
-        /* mark ethernet header */
-        gnrc_pktsnip_t *eth_hdr = gnrc_pktbuf_mark(pkt, sizeof(ethernet_hdr_t), GNRC_NETTYPE_UNDEF);
+        /* free the unused space and mark ethernet header */
+        gnrc_pktsnip_t *eth_hdr = gnrc_pktbuf_commit(pkt, nread,
+                                                     sizeof(ethernet_hdr_t),
+                                                     GNRC_NETTYPE_UNDEF);
         if (!eth_hdr) {
             DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
             goto safe_out;
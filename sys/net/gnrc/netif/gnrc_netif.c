@@ -16,10 +16,10 @@
  */
 
 #include <assert.h>
+#include <inttypes.h>
 #include <string.h>
 #include <kernel_defines.h>
 
-#include "bitfield.h"
 #include "event.h"
 #include "net/ethernet.h"
 #include "net/ipv6.h"
@@ -31,6 +31,9 @@
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
 #include "net/gnrc/netif/pktq.h"
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+#if IS_USED(MODULE_GNRC_NETIF_RX_TRAIN)
+#include "net/gnrc/ipv6.h"
+#endif /* IS_USED(MODULE_GNRC_NETIF_RX_TRAIN) */
 #if IS_USED(MODULE_NETSTATS)
 #include "net/netstats.h"
 #endif /* IS_USED(MODULE_NETSTATS) */
@@ -51,6 +54,7 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif);
 static void _configure_netdev(netdev_t *dev);
 static void *_gnrc_netif_thread(void *args);
 static void _event_cb(netdev_t *dev, netdev_event_t event);
+static void _rx_train_flush(gnrc_netif_t *netif);
 
 int gnrc_netif_create(gnrc_netif_t *netif, char *stack, int stacksize,
                       char priority, const char *name, netdev_t *netdev,
@@ -424,6 +428,9 @@ static int _group_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr);
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
+/* bit of the address at index idx in a gnrc_netif_ipv6_addrs_mask_t */
+#define _ADDR_BIT(idx)  ((gnrc_netif_ipv6_addrs_mask_t)1 << (idx))
+
 /**
  * @brief   Matches an address by prefix to an address on the interface and
  *          return length of the best match
@@ -464,6 +471,18 @@ static int _match_to_idx(const gnrc_netif_t *netif,
  * see http://tools.ietf.org/html/rfc6724#section-4
  */
 static uint8_t _get_scope(const ipv6_addr_t *addr);
+
+/**
+ * @brief Determines the index of the scope of a unicast address in
+ *        gnrc_netif_ipv6_t::addrs_scopes
+ *
+ * @param[in] addr              The IPv6 address to check.
+ *
+ * @return Index of the scope of the address.
+ *
+ * @pre address is not multicast, loopback, or unspecified.
+ */
+static unsigned _scopes_idx(const ipv6_addr_t *addr);
 static inline unsigned _get_state(const gnrc_netif_t *netif, unsigned idx);
 
 /**
@@ -472,21 +491,21 @@ static inline unsigned _get_state(const gnrc_netif_t *netif, unsigned idx);
  *      RFC6724, section 4
  *      </a>
  * @param[in]  netif            the interface used for sending
- * @param[in]  dst              the destination address
  * @param[in]  ll_only          only consider link-local addresses
- * @param[out] candidate_set    a bitfield representing all addresses
- *                              configured to @p netif, potential candidates
- *                              will be marked as 1
+ * @param[out] deprecated       the deprecated addresses among the candidates
+ * @param[out] scopes           the candidates per scope, in the order of
+ *                              gnrc_netif_ipv6_t::addrs_scopes
  *
- * @return -1 if no candidates were found
- * @return the index of the first candidate otherwise
+ * @return a bitmask over the addresses configured to @p netif, potential
+ *         candidates are marked as 1
  *
  * @pre the interface entry and its set of addresses must not be changed during
  *      runtime of this function
  */
-static int _create_candidate_set(const gnrc_netif_t *netif,
-                                 const ipv6_addr_t *dst, bool ll_only,
-                                 uint8_t *candidate_set);
+static gnrc_netif_ipv6_addrs_mask_t _create_candidate_set(
+        const gnrc_netif_t *netif, bool ll_only,
+        gnrc_netif_ipv6_addrs_mask_t *deprecated,
+        gnrc_netif_ipv6_addrs_mask_t *scopes);
 
 /** @brief Find the best candidate among the configured addresses
  *          for a certain destination address according to the 8 rules
@@ -497,17 +516,23 @@ static int _create_candidate_set(const gnrc_netif_t *netif,
  *
  * @param[in] netif              The interface for sending.
  * @param[in] dst                The destination IPv6 address.
- * @param[in, out] candidate_set The preselected set of candidate addresses as
- *                               a bitfield.
+ * @param[in] candidates         The preselected set of candidate addresses as
+ *                               a bitmask.
+ * @param[in] deprecated         The deprecated addresses among
+ *                               @p candidates as a bitmask.
+ * @param[in] scopes             @p candidates per scope as returned by
+ *                               _create_candidate_set().
  *
  * @pre @p dst is not unspecified.
  *
- * @return The best matching candidate found on @p netif, may be NULL if none
- *         is found.
+ * @return The best matching candidate found on @p netif.
+ * @return NULL, if @p candidates is 0.
  */
 static ipv6_addr_t *_src_addr_selection(gnrc_netif_t *netif,
                                         const ipv6_addr_t *dst,
-                                        uint8_t *candidate_set);
+                                        gnrc_netif_ipv6_addrs_mask_t candidates,
+                                        gnrc_netif_ipv6_addrs_mask_t deprecated,
+                                        const gnrc_netif_ipv6_addrs_mask_t *scopes);
 
 int gnrc_netif_ipv6_addr_add_internal(gnrc_netif_t *netif,
                                       const ipv6_addr_t *addr,
@@ -567,6 +592,8 @@ int gnrc_netif_ipv6_addr_add_internal(gnrc_netif_t *netif,
 #endif /* CONFIG_GNRC_IPV6_NIB_ARSM */
     netif->ipv6.addrs_flags[idx] = flags;
     memcpy(&netif->ipv6.addrs[idx], addr, sizeof(netif->ipv6.addrs[idx]));
+    netif->ipv6.addrs_pfx_len[idx] = pfx_len;
+    netif->ipv6.addrs_scopes[_scopes_idx(addr)] |= _ADDR_BIT(idx);
 #ifdef MODULE_GNRC_IPV6_NIB
     if (_get_state(netif, idx) == GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) {
         void *state = NULL;
@@ -595,8 +622,6 @@ int gnrc_netif_ipv6_addr_add_internal(gnrc_netif_t *netif,
 
         msg_send(&msg, gnrc_ipv6_pid);
     }
-#else
-    (void)pfx_len;
 #endif
     gnrc_netif_release(netif);
     return idx;
@@ -615,6 +640,10 @@ void gnrc_netif_ipv6_addr_remove_internal(gnrc_netif_t *netif,
         if (ipv6_addr_equal(&netif->ipv6.addrs[i], addr)) {
             netif->ipv6.addrs_flags[i] = 0;
             ipv6_addr_set_unspecified(&netif->ipv6.addrs[i]);
+            netif->ipv6.addrs_pfx_len[i] = 0;
+            for (unsigned j = 0; j < GNRC_NETIF_IPV6_ADDRS_SCOPES_NUMOF; j++) {
+                netif->ipv6.addrs_scopes[j] &= ~_ADDR_BIT(i);
+            }
         }
         else {
             ipv6_addr_t tmp;
@@ -663,22 +692,15 @@ ipv6_addr_t *gnrc_netif_ipv6_addr_best_src(gnrc_netif_t *netif,
                                            bool ll_only)
 {
     ipv6_addr_t *best_src = NULL;
-
-    BITFIELD(candidate_set, CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF);
+    gnrc_netif_ipv6_addrs_mask_t candidates, deprecated;
+    gnrc_netif_ipv6_addrs_mask_t scopes[GNRC_NETIF_IPV6_ADDRS_SCOPES_NUMOF];
 
     assert((netif != NULL) && (dst != NULL));
     DEBUG("gnrc_netif: get best source address for %s\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
-    memset(candidate_set, 0, sizeof(candidate_set));
     gnrc_netif_acquire(netif);
-    int first_candidate = _create_candidate_set(netif, dst, ll_only,
-                                                candidate_set);
-    if (first_candidate >= 0) {
-        best_src = _src_addr_selection(netif, dst, candidate_set);
-        if (best_src == NULL) {
-            best_src = &(netif->ipv6.addrs[first_candidate]);
-        }
-    }
+    candidates = _create_candidate_set(netif, ll_only, &deprecated, scopes);
+    best_src = _src_addr_selection(netif, dst, candidates, deprecated, scopes);
     gnrc_netif_release(netif);
     return best_src;
 }
@@ -940,46 +962,42 @@ static uint8_t _get_scope(const ipv6_addr_t *addr)
     }
 }
 
+static unsigned _scopes_idx(const ipv6_addr_t *addr)
+{
+    if (ipv6_addr_is_link_local(addr)) {
+        return 0;
+    }
+    else if (ipv6_addr_is_site_local(addr)) {
+        return 1;
+    }
+    else {
+        return 2;
+    }
+}
+
 static inline unsigned _get_state(const gnrc_netif_t *netif, unsigned idx)
 {
     return (netif->ipv6.addrs_flags[idx] &
             GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_MASK);
 }
 
-/**
- * @brief selects potential source address candidates
- * @see <a href="http://tools.ietf.org/html/rfc6724#section-4">
- *      RFC6724, section 4
- *      </a>
- * @param[in]  netif            the interface used for sending
- * @param[in]  dst              the destination address
- * @param[in]  ll_only          only consider link-local addresses
- * @param[out] candidate_set    a bitfield representing all addresses
- *                              configured to @p netif, potential candidates
- *                              will be marked as 1
- *
- * @return -1 if no candidates were found
- * @return the index of the first candidate otherwise
- *
- * @pre the interface entry and its set of addresses must not be changed during
- *      runtime of this function
- */
-static int _create_candidate_set(const gnrc_netif_t *netif,
-                                 const ipv6_addr_t *dst, bool ll_only,
-                                 uint8_t *candidate_set)
+static gnrc_netif_ipv6_addrs_mask_t _create_candidate_set(
+        const gnrc_netif_t *netif, bool ll_only,
+        gnrc_netif_ipv6_addrs_mask_t *deprecated,
+        gnrc_netif_ipv6_addrs_mask_t *scopes)
 {
-    int res = -1;
+    gnrc_netif_ipv6_addrs_mask_t candidates = 0, scoped = 0;
 
     DEBUG("gathering source address candidates\n");
     /* currently this implementation supports only addresses as source address
      * candidates assigned to this interface. Thus we assume all addresses to be
      * on interface @p netif */
-    (void) dst;
-    for (int i = 0; i < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
-        const ipv6_addr_t *tmp = &(netif->ipv6.addrs[i]);
-
-        DEBUG("Checking address: %s\n",
-              ipv6_addr_to_str(addr_str, tmp, sizeof(addr_str)));
+    *deprecated = 0;
+    for (unsigned i = 0; i < GNRC_NETIF_IPV6_ADDRS_SCOPES_NUMOF; i++) {
+        scopes[i] = netif->ipv6.addrs_scopes[i];
+        scoped |= scopes[i];
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
         /* "In any case, multicast addresses and the unspecified address MUST
          * NOT be included in a candidate set."
          *
@@ -998,10 +1016,6 @@ static int _create_candidate_set(const gnrc_netif_t *netif,
             gnrc_netif_ipv6_addr_dad_trans(netif, i)) {
             continue;
         }
-        /* Check if we only want link local addresses */
-        if (ll_only && !ipv6_addr_is_link_local(tmp)) {
-            continue;
-        }
         /* "For all multicast and link-local destination addresses, the set of
          *  candidate source addresses MUST only include addresses assigned to
          *  interfaces belonging to the same link as the outgoing interface."
@@ -1013,182 +1027,151 @@ static int _create_candidate_set(const gnrc_netif_t *netif,
          *     the sending interface
          */
         /* put all other addresses into the candidate set */
-        DEBUG("add to candidate set\n");
-        bf_set(candidate_set, i);
-        if (res < 0) {
-            res = i;
+        candidates |= _ADDR_BIT(i);
+        /* addresses not added by gnrc_netif_ipv6_addr_add_internal() (e.g.
+         * written into gnrc_netif_ipv6_t::addrs directly) are in no scope
+         * yet */
+        if (!(scoped & _ADDR_BIT(i))) {
+            scopes[_scopes_idx(&netif->ipv6.addrs[i])] |= _ADDR_BIT(i);
+        }
+        if (_get_state(netif, i) ==
+            GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_DEPRECATED) {
+            *deprecated |= _ADDR_BIT(i);
         }
     }
-    return res;
-}
-
-/* number of "points" assigned to an source address candidate with equal scope
- * than destination address */
-#define RULE_2_PTS          (IPV6_ADDR_MCAST_SCP_GLOBAL + 1)
-/* number of "points" assigned to an source address candidate in preferred
- * state */
-#define RULE_3_PTS          (1)
-
-/**
- * @brief   Caps the match at a source addresses prefix length
- *
- * @see https://tools.ietf.org/html/rfc6724#section-2.2
- *
- * @param[in] netif The network interface @p src was selected from
- * @param[in] src   A potential source address
- * @param[in] match The number of bits matching of @p src with another address
- *
- * @return  @p match or a number lesser than @p match, if @p src has a shorter
- *          prefix.
- */
-static unsigned _cap_match(const gnrc_netif_t *netif, const ipv6_addr_t *src,
-                           unsigned match)
-{
-    unsigned best_prefix = 0;
-
-    if (ipv6_addr_is_link_local(src)) {
-        best_prefix = 64U;  /* Link-local prefix is always of length 64 */
+    /* Check if we only want link local addresses */
+    if (ll_only) {
+        candidates &= scopes[0];
     }
-#ifdef MODULE_GNRC_IPV6_NIB
-    else {
-        void *state = NULL;
-        gnrc_ipv6_nib_pl_t ple;
-
-        while (gnrc_ipv6_nib_pl_iter(netif->pid, &state, &ple)) {
-            if ((ipv6_addr_match_prefix(&ple.pfx, src) > best_prefix)) {
-                best_prefix = ple.pfx_len;
-            }
-        }
+    for (unsigned i = 0; i < GNRC_NETIF_IPV6_ADDRS_SCOPES_NUMOF; i++) {
+        scopes[i] &= candidates;
     }
-#endif /* MODULE_GNRC_IPV6_NIB */
-    return ((best_prefix > 0) && (best_prefix < match)) ? best_prefix : match;
+    *deprecated &= candidates;
+    DEBUG("candidate set: 0x%" PRIx32 "\n", (uint32_t)candidates);
+    return candidates;
 }
 
 static ipv6_addr_t *_src_addr_selection(gnrc_netif_t *netif,
                                         const ipv6_addr_t *dst,
-                                        uint8_t *candidate_set)
+                                        gnrc_netif_ipv6_addrs_mask_t candidates,
+                                        gnrc_netif_ipv6_addrs_mask_t deprecated,
+                                        const gnrc_netif_ipv6_addrs_mask_t *scopes)
 {
-    int idx = -1;
-    /* create temporary set for assigning "points" to candidates winning in the
-     * corresponding rules.
-     */
-    uint8_t winner_set[CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF];
-
-    memset(winner_set, 0, CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF);
-    uint8_t max_pts = 0;
+    /* scopes of gnrc_netif_ipv6_t::addrs_scopes */
+    static const uint8_t scope_ids[] = {
+        IPV6_ADDR_MCAST_SCP_LINK_LOCAL,
+        IPV6_ADDR_MCAST_SCP_SITE_LOCAL,
+        IPV6_ADDR_MCAST_SCP_GLOBAL,
+    };
+    gnrc_netif_ipv6_addrs_mask_t winners = 0;
     /* _create_candidate_set() assures that `dst` is not unspecified and if
      * `dst` is loopback rule 1 will fire anyway.  */
     uint8_t dst_scope = _get_scope(dst);
+    unsigned best_match = 0;
+    int idx = -1;
 
+    if (candidates == 0) {
+        return NULL;
+    }
     DEBUG("finding the best match within the source address candidates\n");
+    /* Rule 1: if we have an address configured that equals the destination
+     * use this one as source */
     for (unsigned i = 0; i < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
-        ipv6_addr_t *ptr = &(netif->ipv6.addrs[i]);
-
-        DEBUG("Checking address: %s\n",
-              ipv6_addr_to_str(addr_str, ptr, sizeof(addr_str)));
-        /* entries which are not part of the candidate set can be ignored */
-        if (!(bf_isset(candidate_set, i))) {
-            DEBUG("Not part of the candidate set - skipping\n");
-            continue;
-        }
-        /* Rule 1: if we have an address configured that equals the destination
-         * use this one as source */
-        if (ipv6_addr_equal(ptr, dst)) {
+        if ((candidates & _ADDR_BIT(i)) &&
+            ipv6_addr_equal(&netif->ipv6.addrs[i], dst)) {
             DEBUG("Ease one - rule 1\n");
-            return ptr;
-        }
-        /* Rule 2: Prefer appropriate scope. */
-        uint8_t candidate_scope = _get_scope(ptr);
-        if (candidate_scope == dst_scope) {
-            DEBUG("winner for rule 2 (same scope) found\n");
-            winner_set[i] += (dst_scope + RULE_2_PTS);
-        }
-        else if (candidate_scope > dst_scope) {
-            DEBUG("winner for rule 2 (larger scope) found\n");
-            /* From https://tools.ietf.org/html/rfc6724#section-5:
-             * >  Rule 2: Prefer appropriate scope.
-             * >  If Scope(SA) < Scope(SB): If Scope(SA) < Scope(D), then prefer
-             * >  SB and otherwise prefer SA.
-             * Meaning give address with larger scope than `dst` but closest to
-             * `dst` precedence.
-             * As the if above already ensures that the scope is larger than
-             * the scope of the destination address we give the address with the
-             * smallest scope that lands here the highest score */
-            winner_set[i] += (dst_scope + (RULE_2_PTS - candidate_scope));
-        }
-        else {
-            DEBUG("winner for rule 2 (smaller scope) found\n");
-            /* don't add `dst_scope` here to keep it smaller than larger and
-             * equal scope */
-            winner_set[i] += candidate_scope;
+            return &netif->ipv6.addrs[i];
         }
+    }
 
-        /* Rule 3: Avoid deprecated addresses. */
-        if (_get_state(netif, i) !=
-            GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_DEPRECATED) {
-            DEBUG("winner for rule 3 found\n");
-            winner_set[i] += RULE_3_PTS;
+    /* Rule 2: Prefer appropriate scope.
+     * From https://tools.ietf.org/html/rfc6724#section-5:
+     * >  If Scope(SA) < Scope(SB): If Scope(SA) < Scope(D), then prefer
+     * >  SB and otherwise prefer SA.
+     * Meaning prefer the smallest scope that is not smaller than the scope of
+     * `dst` and otherwise the largest scope. As the scopes are in ascending
+     * order, the last scope with candidates wins unless a scope not smaller
+     * than the one of `dst` comes first. */
+    for (unsigned i = 0; i < ARRAY_SIZE(scope_ids); i++) {
+        if (scopes[i] != 0) {
+            winners = scopes[i];
+            if (scope_ids[i] >= dst_scope) {
+                break;
+            }
         }
+    }
+    DEBUG("winners for rule 2: 0x%" PRIx32 "\n", (uint32_t)winners);
+    /* every candidate is in one of the scopes */
+    assert(winners != 0);
 
-        /* Rule 4: Prefer home addresses.
-         * Does not apply, gnrc does not support Mobile IP.
-         * TODO: update as soon as gnrc supports Mobile IP
-         */
+    /* Rule 3: Avoid deprecated addresses. */
+    if ((winners & ~deprecated) != 0) {
+        winners &= ~deprecated;
+    }
+    DEBUG("winners for rule 3: 0x%" PRIx32 "\n", (uint32_t)winners);
 
-        /* Rule 5: Prefer outgoing interface.
-         * RFC 6724 says:
-         * "It is RECOMMENDED that the candidate source addresses be the set of
-         *  unicast addresses assigned to the interface that will be used to
-         *  send to the destination (the "outgoing" interface).  On routers,
-         *  the candidate set MAY include unicast addresses assigned to any
-         *  interface that forwards packets, subject to the restrictions
-         *  described below."
-         *  Currently this implementation uses ALWAYS source addresses assigned
-         *  to the outgoing interface. Hence, Rule 5 is always fulfilled.
-         */
+    /* Rule 4: Prefer home addresses.
+     * Does not apply, gnrc does not support Mobile IP.
+     * TODO: update as soon as gnrc supports Mobile IP
+     */
 
-        /* Rule 6: Prefer matching label.
-         * Flow labels are currently not supported by gnrc.
-         * TODO: update as soon as gnrc supports flow labels
-         */
+    /* Rule 5: Prefer outgoing interface.
+     * RFC 6724 says:
+     * "It is RECOMMENDED that the candidate source addresses be the set of
+     *  unicast addresses assigned to the interface that will be used to
+     *  send to the destination (the "outgoing" interface).  On routers,
+     *  the candidate set MAY include unicast addresses assigned to any
+     *  interface that forwards packets, subject to the restrictions
+     *  described below."
+     *  Currently this implementation uses ALWAYS source addresses assigned
+     *  to the outgoing interface. Hence, Rule 5 is always fulfilled.
+     */
 
-        /* Rule 7: Prefer temporary addresses.
-         * Temporary addresses are currently not supported by gnrc.
-         * TODO: update as soon as gnrc supports temporary addresses
-         */
+    /* Rule 6: Prefer matching label.
+     * Flow labels are currently not supported by gnrc.
+     * TODO: update as soon as gnrc supports flow labels
+     */
 
-        if (winner_set[i] > max_pts) {
+    /* Rule 7: Prefer temporary addresses.
+     * Temporary addresses are currently not supported by gnrc.
+     * TODO: update as soon as gnrc supports temporary addresses
+     */
+
+    /* check if we have a clear winner, otherwise
+     * rule 8: Use longest matching prefix, but not beyond the prefix of the
+     * candidate (see https://tools.ietf.org/html/rfc6724#section-2.2) */
+    bool clear_winner = ((winners & (winners - 1)) == 0);
+
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
+        if (!(winners & _ADDR_BIT(i))) {
+            continue;
+        }
+        if (clear_winner) {
             idx = i;
-            max_pts = winner_set[i];
+            break;
         }
-    }
-    /* check if we have a clear winner, otherwise
-     * rule 8: Use longest matching prefix.*/
-    uint8_t best_match = 0;
-    /* collect candidates with maximum points */
-    for (int i = 0; i < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
-        if (winner_set[i] == max_pts) {
-            const ipv6_addr_t *addr = &netif->ipv6.addrs[i];
-            unsigned match = ipv6_addr_match_prefix(addr, dst);
-
-            match = _cap_match(netif, addr, match);
-            /* if match == 0 for all case, it takes above selected idx */
-            if (match > best_match) {
-                idx = i;
-                best_match = match;
-            }
+
+        unsigned match = ipv6_addr_match_prefix(&netif->ipv6.addrs[i], dst);
+
+        /* prefix length is unknown (0) for addresses not added by
+         * gnrc_netif_ipv6_addr_add_internal() */
+        if ((netif->ipv6.addrs_pfx_len[i] > 0) &&
+            (match > netif->ipv6.addrs_pfx_len[i])) {
+            match = netif->ipv6.addrs_pfx_len[i];
+        }
+        /* if match == 0 for all case, it takes the first winner */
+        if ((idx < 0) || (match > best_match)) {
+            idx = i;
+            best_match = match;
         }
     }
     if (idx < 0) {
-        DEBUG("No winner found\n");
         return NULL;
     }
-    else {
-        DEBUG("Winner is: %s\n", ipv6_addr_to_str(addr_str,
-                                                  &netif->ipv6.addrs[idx],
-                                                  sizeof(addr_str)));
-        return &netif->ipv6.addrs[idx];
-    }
+    DEBUG("Winner is: %s\n", ipv6_addr_to_str(addr_str,
+                                              &netif->ipv6.addrs[idx],
+                                              sizeof(addr_str)));
+    return &netif->ipv6.addrs[idx];
 }
 #endif  /* IS_USED(MODULE_GNRC_NETIF_IPV6) */
 
@@ -1447,6 +1430,8 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
             if (msg_waiting > 0) {
                 return;
             }
+            /* nothing more to receive for now */
+            _rx_train_flush(netif);
             DEBUG("gnrc_netif: waiting for events\n");
             /* Block the thread until something interesting happens */
             thread_flags_wait_any(THREAD_FLAG_MSG_WAITING | THREAD_FLAG_EVENT);
@@ -1454,6 +1439,10 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
     }
     else {
         /* Only messages used for event handling */
+        if (msg_avail() == 0) {
+            /* nothing more to receive for now */
+            _rx_train_flush(netif);
+        }
         DEBUG("gnrc_netif: waiting for incoming messages\n");
         msg_receive(msg);
     }
@@ -1671,8 +1660,112 @@ static void *_gnrc_netif_thread(void *args)
     return NULL;
 }
 
-static void _pass_on_packet(gnrc_pktsnip_t *pkt)
+#if IS_USED(MODULE_GNRC_NETIF_RX_TRAIN)
+/* only gnrc_ipv6 knows how to handle packet trains, so they are only passed
+ * on if it is the sole receiver of IPv6 packets */
+static kernel_pid_t _rx_train_receiver(void)
 {
+    gnrc_netreg_entry_t *entry;
+
+    if (gnrc_netreg_num(GNRC_NETTYPE_IPV6, GNRC_NETREG_DEMUX_CTX_ALL) != 1) {
+        return KERNEL_PID_UNDEF;
+    }
+    entry = gnrc_netreg_lookup(GNRC_NETTYPE_IPV6, GNRC_NETREG_DEMUX_CTX_ALL);
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+    if (entry->type != GNRC_NETREG_TYPE_DEFAULT) {
+        return KERNEL_PID_UNDEF;
+    }
+#endif
+    if (entry->target.pid != gnrc_ipv6_pid) {
+        return KERNEL_PID_UNDEF;
+    }
+    return entry->target.pid;
+}
+
+static void _rx_train_flush(gnrc_netif_t *netif)
+{
+    gnrc_pktsnip_t *train = netif->rx_train;
+    kernel_pid_t receiver;
+
+    if (train == NULL) {
+        return;
+    }
+    DEBUG("gnrc_netif: passing on train of %u packets\n",
+          (unsigned)netif->rx_train_len);
+    /* the registrations might have changed since the packets were added, so
+     * the receiver is resolved only now */
+    receiver = (netif->rx_train_len > 1) ? _rx_train_receiver()
+                                         : KERNEL_PID_UNDEF;
+    netif->rx_train = NULL;
+    netif->rx_train_len = 0;
+    if (receiver != KERNEL_PID_UNDEF) {
+        if (_gnrc_netapi_send_recv(receiver, train,
+                                   GNRC_NETAPI_MSG_TYPE_RCV_TRAIN) < 1) {
+            DEBUG("gnrc_netif: unable to forward packet train\n");
+            gnrc_pktbuf_release(train);
+        }
+        return;
+    }
+    while (train != NULL) {
+        gnrc_pktsnip_t *pkt = gnrc_netapi_train_pop(&train);
+
+        if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                          GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+            DEBUG("gnrc_netif: unable to forward packet of train\n");
+            gnrc_pktbuf_release(pkt);
+        }
+    }
+}
+
+static bool _rx_train_add(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *tail = pkt;
+
+    if ((pkt->type != GNRC_NETTYPE_IPV6) ||
+        /* no need to collect packets nobody can receive as a train */
+        (_rx_train_receiver() == KERNEL_PID_UNDEF)) {
+        return false;
+    }
+    while (tail->next != NULL) {
+        tail = tail->next;
+    }
+    /* the netif header separates the packets of a train */
+    if (tail->type != GNRC_NETTYPE_NETIF) {
+        return false;
+    }
+    if (netif->rx_train == NULL) {
+        netif->rx_train = pkt;
+    }
+    else {
+        netif->rx_train_tail->next = pkt;
+    }
+    netif->rx_train_tail = tail;
+    if (++netif->rx_train_len >= CONFIG_GNRC_NETIF_RX_TRAIN_LEN) {
+        _rx_train_flush(netif);
+    }
+    return true;
+}
+#else
+static void _rx_train_flush(gnrc_netif_t *netif)
+{
+    (void)netif;
+}
+
+static inline bool _rx_train_add(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    (void)netif;
+    (void)pkt;
+    return false;
+}
+#endif /* IS_USED(MODULE_GNRC_NETIF_RX_TRAIN) */
+
+static void _pass_on_packet(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    if (_rx_train_add(netif, pkt)) {
+        return;
+    }
+    /* keep order of received packets */
+    _rx_train_flush(netif);
     /* throw away packet if no one is interested */
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL,
                                       pkt)) {
@@ -1710,7 +1803,7 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                  * Further packets will be sent on later TX_COMPLETE */
                 _send_queued_pkt(netif);
                 if (pkt) {
-                    _pass_on_packet(pkt);
+                    _pass_on_packet(netif, pkt);
                 }
                 break;
 #if IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_GNRC_NETIF_PKTQ)
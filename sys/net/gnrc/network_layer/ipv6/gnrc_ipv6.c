@@ -67,6 +67,31 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
 
+typedef struct _route_cache_entry _route_cache_entry_t;
+
+#if IS_USED(MODULE_GNRC_IPV6_ROUTE_CACHE)
+/**
+ * @brief   Result of the next hop lookup and source address selection for a
+ *          destination
+ */
+struct _route_cache_entry {
+    ipv6_addr_t dst;            /**< destination address */
+    ipv6_addr_t src;            /**< source address chosen for _route_cache_entry::dst */
+    gnrc_ipv6_nib_nc_t nce;     /**< next hop to _route_cache_entry::dst */
+    uint32_t gen;               /**< NIB generation the entry is valid for */
+    kernel_pid_t req_iface;     /**< interface the lookup was restricted to */
+    /**
+     * @brief   Index of _route_cache_entry::src on the interface of the next
+     *          hop, -1 if none was chosen yet
+     */
+    int8_t src_idx;
+};
+
+/* only accessed by the IPv6 thread */
+static _route_cache_entry_t _route_cache[CONFIG_GNRC_IPV6_ROUTE_CACHE_SIZE];
+static unsigned _route_cache_next;
+#endif  /* MODULE_GNRC_IPV6_ROUTE_CACHE */
+
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
 /* Sends packet over the appropriate interface(s).
@@ -200,6 +225,18 @@ static void *_event_loop(void *args)
                 _receive(msg.content.ptr);
                 break;
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_TRAIN)
+            case GNRC_NETAPI_MSG_TYPE_RCV_TRAIN: {
+                gnrc_pktsnip_t *train = msg.content.ptr;
+
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV_TRAIN received\n");
+                while (train != NULL) {
+                    _receive(gnrc_netapi_train_pop(&train));
+                }
+                break;
+            }
+#endif  /* IS_USED(MODULE_GNRC_NETIF_RX_TRAIN) */
+
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
                 _send(msg.content.ptr, true);
@@ -323,7 +360,147 @@ static bool _is_ipv6_hdr(gnrc_pktsnip_t *hdr)
 #endif
 }
 
-static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
+#if IS_USED(MODULE_GNRC_IPV6_ROUTE_CACHE)
+static _route_cache_entry_t *_route_cache_get(const ipv6_addr_t *dst,
+                                              const gnrc_netif_t *netif)
+{
+    kernel_pid_t req_iface = (netif == NULL) ? KERNEL_PID_UNDEF : netif->pid;
+    uint32_t gen = gnrc_ipv6_nib_gen();
+
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_ROUTE_CACHE_SIZE; i++) {
+        _route_cache_entry_t *rce = &_route_cache[i];
+
+        if ((rce->gen == gen) && (rce->req_iface == req_iface) &&
+            ipv6_addr_equal(&rce->dst, dst)) {
+            return rce;
+        }
+    }
+    return NULL;
+}
+
+static _route_cache_entry_t *_route_cache_add(const ipv6_addr_t *dst,
+                                              const gnrc_netif_t *netif,
+                                              const gnrc_ipv6_nib_nc_t *nce,
+                                              uint32_t gen)
+{
+    uint32_t cur_gen = gnrc_ipv6_nib_gen();
+    _route_cache_entry_t *rce = NULL;
+
+    if (cur_gen != gen) {
+        /* the NIB changed during the lookup, so nce might already be
+         * outdated */
+        return NULL;
+    }
+    if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)) {
+        unsigned nud_state = gnrc_ipv6_nib_nc_get_nud_state(nce);
+
+        /* NUD needs to see the packets to any other neighbor */
+        if ((nud_state != GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED) &&
+            (nud_state != GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE)) {
+            return NULL;
+        }
+    }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+    gnrc_netif_t *nh_netif = gnrc_netif_get_by_pid(
+            gnrc_ipv6_nib_nc_get_iface(nce)
+        );
+
+    /* the routing protocol wants to be informed about every route usage */
+    if ((nh_netif == NULL) || (nh_netif->ipv6.route_info_cb != NULL)) {
+        return NULL;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTER */
+    /* prefer outdated entries, otherwise replace round robin */
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_ROUTE_CACHE_SIZE; i++) {
+        if (_route_cache[i].gen != cur_gen) {
+            rce = &_route_cache[i];
+            break;
+        }
+    }
+    if (rce == NULL) {
+        rce = &_route_cache[_route_cache_next];
+        _route_cache_next = (_route_cache_next + 1) %
+                            CONFIG_GNRC_IPV6_ROUTE_CACHE_SIZE;
+    }
+    memcpy(&rce->dst, dst, sizeof(rce->dst));
+    memcpy(&rce->nce, nce, sizeof(rce->nce));
+    rce->gen = cur_gen;
+    rce->req_iface = (netif == NULL) ? KERNEL_PID_UNDEF : netif->pid;
+    rce->src_idx = -1;
+    return rce;
+}
+
+static const ipv6_addr_t *_route_cache_src(_route_cache_entry_t *rce,
+                                           gnrc_netif_t *netif)
+{
+    const ipv6_addr_t *src = NULL;
+
+    gnrc_netif_acquire(netif);
+    /* addresses may be removed without the NIB noticing, so check the cached
+     * one is still assigned */
+    if ((rce->src_idx >= 0) &&
+        ipv6_addr_equal(&netif->ipv6.addrs[rce->src_idx], &rce->src) &&
+        (gnrc_netif_ipv6_addr_get_state(netif, rce->src_idx) ==
+         GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID)) {
+        src = &netif->ipv6.addrs[rce->src_idx];
+    }
+    gnrc_netif_release(netif);
+    if (src == NULL) {
+        src = gnrc_netif_ipv6_addr_best_src(netif, &rce->dst, false);
+        if (src != NULL) {
+            rce->src_idx = src - netif->ipv6.addrs;
+            memcpy(&rce->src, src, sizeof(rce->src));
+        }
+    }
+    return src;
+}
+#endif  /* MODULE_GNRC_IPV6_ROUTE_CACHE */
+
+/* like gnrc_ipv6_nib_get_next_hop_l2addr() but consults the route cache first;
+ * rce is set to the route cache entry for dst or NULL */
+static int _get_next_hop_l2addr(const ipv6_addr_t *dst, gnrc_netif_t *netif,
+                                gnrc_pktsnip_t *pkt, gnrc_ipv6_nib_nc_t *nce,
+                                _route_cache_entry_t **rce)
+{
+#if IS_USED(MODULE_GNRC_IPV6_ROUTE_CACHE)
+    uint32_t gen;
+    int res;
+
+    if ((*rce = _route_cache_get(dst, netif)) != NULL) {
+        DEBUG("ipv6: next hop to %s found in route cache\n",
+              ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+        memcpy(nce, &(*rce)->nce, sizeof(*nce));
+        return 0;
+    }
+    gen = gnrc_ipv6_nib_gen();
+    res = gnrc_ipv6_nib_get_next_hop_l2addr(dst, netif, pkt, nce);
+    if (res == 0) {
+        *rce = _route_cache_add(dst, netif, nce, gen);
+    }
+    return res;
+#else   /* MODULE_GNRC_IPV6_ROUTE_CACHE */
+    *rce = NULL;
+    return gnrc_ipv6_nib_get_next_hop_l2addr(dst, netif, pkt, nce);
+#endif  /* MODULE_GNRC_IPV6_ROUTE_CACHE */
+}
+
+static const ipv6_addr_t *_best_src(gnrc_netif_t *netif,
+                                    const ipv6_addr_t *dst,
+                                    _route_cache_entry_t *rce)
+{
+#if IS_USED(MODULE_GNRC_IPV6_ROUTE_CACHE)
+    if (rce != NULL) {
+        return _route_cache_src(rce, netif);
+    }
+#else   /* MODULE_GNRC_IPV6_ROUTE_CACHE */
+    (void)rce;
+#endif  /* MODULE_GNRC_IPV6_ROUTE_CACHE */
+    return gnrc_netif_ipv6_addr_best_src(netif, dst, false);
+}
+
+/* rce: route cache entry for the destination of ipv6, may be NULL */
+static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6,
+                          _route_cache_entry_t *rce)
 {
     int res;
     ipv6_hdr_t *hdr = ipv6->data;
@@ -364,8 +541,7 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
             ipv6_addr_set_loopback(&hdr->src);
         }
         else {
-            ipv6_addr_t *src = gnrc_netif_ipv6_addr_best_src(netif, &hdr->dst,
-                                                             false);
+            const ipv6_addr_t *src = _best_src(netif, &hdr->dst, rce);
 
             if (src != NULL) {
                 DEBUG("ipv6: set packet source to %s\n",
@@ -436,9 +612,9 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
 }
 
 static bool _safe_fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
-                                bool prep_hdr)
+                                bool prep_hdr, _route_cache_entry_t *rce)
 {
-    if (prep_hdr && (_fill_ipv6_hdr(netif, pkt) < 0)) {
+    if (prep_hdr && (_fill_ipv6_hdr(netif, pkt, rce) < 0)) {
         /* error on filling up header */
         gnrc_pktbuf_release(pkt);
         return false;
@@ -483,11 +659,11 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif, ipv6_hdr_t *ipv6_hdr,
                           uint8_t netif_hdr_flags)
 {
+    _route_cache_entry_t *rce;
     gnrc_ipv6_nib_nc_t nce;
 
     DEBUG("ipv6: send unicast\n");
-    if (gnrc_ipv6_nib_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt,
-                                          &nce) < 0) {
+    if (_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt, &nce, &rce) < 0) {
         /* packet is released by NIB */
         DEBUG("ipv6: no link-layer address or interface for next hop to %s\n",
               ipv6_addr_to_str(addr_str, &ipv6_hdr->dst, sizeof(addr_str)));
@@ -495,7 +671,7 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
     }
     netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
     assert(netif != NULL);
-    if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+    if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, rce)) {
         DEBUG("ipv6: add interface header to packet\n");
         if ((pkt = _create_netif_hdr(nce.l2addr, nce.l2addr_len, pkt,
                                      netif_hdr_flags)) == NULL) {
@@ -577,7 +753,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                         gnrc_pktbuf_release(pkt);
                         return;
                     }
-                    if (_fill_ipv6_hdr(netif, send_pkt) < 0) {
+                    if (_fill_ipv6_hdr(netif, send_pkt, NULL) < 0) {
                         /* error on filling up header */
                         if (send_pkt != pkt) {
                             gnrc_pktbuf_release(send_pkt);
@@ -591,7 +767,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
             }
         }
         else {
-            if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+            if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, NULL)) {
                 _send_multicast_over_iface(pkt, prep_hdr, netif, netif_hdr_flags);
             }
         }
@@ -606,7 +782,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                 return;
             }
         }
-        if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+        if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, NULL)) {
             _send_multicast_over_iface(pkt, prep_hdr, netif, netif_hdr_flags);
         }
     }
@@ -615,7 +791,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
 static void _send_to_self(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif)
 {
-    if (!_safe_fill_ipv6_hdr(netif, pkt, prep_hdr) ||
+    if (!_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, NULL) ||
         /* no netif header so we just merge the whole packet. */
         (gnrc_pktbuf_merge(pkt) != 0)) {
         DEBUG("ipv6: error looping packet to sender.\n");
@@ -54,8 +54,11 @@ static inline uint16_t _get_ar_state(const _nib_onl_entry_t *entry)
  */
 static inline void _set_ar_state(_nib_onl_entry_t *entry, uint16_t state)
 {
-    entry->info &= ~GNRC_IPV6_NIB_NC_INFO_AR_STATE_MASK;
-    entry->info |= state;
+    if ((entry->info & GNRC_IPV6_NIB_NC_INFO_AR_STATE_MASK) != state) {
+        entry->info &= ~GNRC_IPV6_NIB_NC_INFO_AR_STATE_MASK;
+        entry->info |= state;
+        _nib_changed();
+    }
 }
 
 /**
@@ -33,6 +33,29 @@
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
+static void _set_is_router(_nib_onl_entry_t *nce, bool is_router)
+{
+    if (!(nce->info & GNRC_IPV6_NIB_NC_INFO_IS_ROUTER) != !is_router) {
+        nce->info ^= GNRC_IPV6_NIB_NC_INFO_IS_ROUTER;
+        _nib_changed();
+    }
+}
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+static void _set_l2addr(_nib_onl_entry_t *nce, const void *l2addr,
+                        int l2addr_len)
+{
+    if ((nce->l2addr_len != l2addr_len) ||
+        ((l2addr_len > 0) && (memcmp(nce->l2addr, l2addr, l2addr_len) != 0))) {
+        nce->l2addr_len = l2addr_len;
+        if (l2addr_len > 0) {
+            memcpy(nce->l2addr, l2addr, l2addr_len);
+        }
+        _nib_changed();
+    }
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+
 void _snd_ns(const ipv6_addr_t *tgt, gnrc_netif_t *netif,
              const ipv6_addr_t *src, const ipv6_addr_t *dst)
 {
@@ -121,7 +144,7 @@ void _handle_sl2ao(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
                           GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE);
         if (nce != NULL) {
             if (icmpv6->type == ICMPV6_NBR_SOL) {
-                nce->info &= ~GNRC_IPV6_NIB_NC_INFO_IS_ROUTER;
+                _set_is_router(nce, false);
             }
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_DAD) && IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_6LR)
             else if (_rtr_sol_on_6lr(netif, icmpv6)) {
@@ -143,20 +166,19 @@ void _handle_sl2ao(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
             DEBUG("nib: %s%%%u is a router\n",
                   ipv6_addr_to_str(addr_str, &nce->ipv6, sizeof(addr_str)),
                   netif->pid);
-            nce->info |= GNRC_IPV6_NIB_NC_INFO_IS_ROUTER;
+            _set_is_router(nce, true);
         }
         else if (icmpv6->type != ICMPV6_NBR_SOL) {
             DEBUG("nib: %s%%%u is probably not a router\n",
                   ipv6_addr_to_str(addr_str, &nce->ipv6, sizeof(addr_str)),
                   netif->pid);
-            nce->info &= ~GNRC_IPV6_NIB_NC_INFO_IS_ROUTER;
+            _set_is_router(nce, false);
         }
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
         /* a 6LR MUST NOT modify an existing NCE based on an SL2AO in an RS
          * see https://tools.ietf.org/html/rfc6775#section-6.3 */
         if (!_rtr_sol_on_6lr(netif, icmpv6)) {
-            nce->l2addr_len = l2addr_len;
-            memcpy(nce->l2addr, sl2ao + 1, l2addr_len);
+            _set_l2addr(nce, sl2ao + 1, l2addr_len);
         }
 #endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
     }
@@ -358,11 +380,10 @@ void _handle_adv_l2(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
         bool nce_was_incomplete =
             (_get_nud_state(nce) == GNRC_IPV6_NIB_NC_INFO_NUD_STATE_INCOMPLETE);
         if (tl2ao != NULL) {
-            nce->l2addr_len = l2addr_len;
-            memcpy(nce->l2addr, tl2ao + 1, l2addr_len);
+            _set_l2addr(nce, tl2ao + 1, l2addr_len);
         }
         else {
-            nce->l2addr_len = 0;
+            _set_l2addr(nce, NULL, 0);
         }
         if (_sflag_set((ndp_nbr_adv_t *)icmpv6)) {
             _set_reachable(netif, nce);
@@ -379,12 +400,7 @@ void _handle_adv_l2(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
         }
         if (_oflag_set((ndp_nbr_adv_t *)icmpv6) ||
             ((icmpv6->type == ICMPV6_NBR_ADV) && nce_was_incomplete)) {
-            if (_rflag_set((ndp_nbr_adv_t *)icmpv6)) {
-                nce->info |= GNRC_IPV6_NIB_NC_INFO_IS_ROUTER;
-            }
-            else {
-                nce->info &= ~GNRC_IPV6_NIB_NC_INFO_IS_ROUTER;
-            }
+            _set_is_router(nce, _rflag_set((ndp_nbr_adv_t *)icmpv6));
         }
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_QUEUE_PKT) && MODULE_GNRC_IPV6
         /* send queued packets */
@@ -441,8 +457,11 @@ void _set_reachable(gnrc_netif_t *netif, _nib_onl_entry_t *nce)
 void _set_nud_state(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
                     uint16_t state)
 {
-    nce->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
-    nce->info |= state;
+    if ((nce->info & GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK) != state) {
+        nce->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
+        nce->info |= state;
+        _nib_changed();
+    }
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
     gnrc_netif_acquire(netif);
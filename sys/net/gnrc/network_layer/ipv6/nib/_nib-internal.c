@@ -25,9 +25,11 @@
 #include "net/gnrc/ipv6/nib/nc.h"
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/netif/internal.h"
+#include "irq.h"
 #include "random.h"
 
 #include "_nib-internal.h"
+#include "_nib-offl-trie.h"
 #include "_nib-router.h"
 
 #define ENABLE_DEBUG 0
@@ -38,6 +40,10 @@ _nib_dr_entry_t *_prime_def_router = NULL;
 static clist_node_t _next_removable = { NULL };
 
 static _nib_onl_entry_t _nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+/* on-link entries with a specified address, hashed by that address */
+static _nib_onl_entry_t *_onl_buckets[1U << CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS_EXP];
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
 static _nib_offl_entry_t _dsts[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
 static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 
@@ -49,6 +55,7 @@ static rmutex_t _nib_mutex = RMUTEX_INIT;
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 evtimer_msg_t _nib_evtimer;
+uint32_t _nib_gen = 0;
 
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
@@ -60,8 +67,12 @@ void _nib_init(void)
     _prime_def_router = NULL;
     _next_removable.next = NULL;
     memset(_nodes, 0, sizeof(_nodes));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    memset(_onl_buckets, 0, sizeof(_onl_buckets));
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+    _nib_offl_trie_init();
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
@@ -80,6 +91,14 @@ void _nib_release(void)
     rmutex_unlock(&_nib_mutex);
 }
 
+void _nib_changed(void)
+{
+    unsigned state = irq_disable();
+
+    _nib_gen++;
+    irq_restore(state);
+}
+
 static inline bool _addr_equals(const ipv6_addr_t *addr,
                                 const _nib_onl_entry_t *node)
 {
@@ -87,6 +106,76 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
            (ipv6_addr_equal(addr, &node->ipv6));
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+static inline _nib_onl_entry_t **_onl_bucket(const ipv6_addr_t *addr)
+{
+    /* Fibonacci hashing of all bits of the address */
+    uint32_t key = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                   addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    return &_onl_buckets[(key * 2654435769U) >>
+                         (32 - CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS_EXP)];
+}
+
+static void _onl_index(_nib_onl_entry_t *node)
+{
+    if (!ipv6_addr_is_unspecified(&node->ipv6)) {
+        _nib_onl_entry_t **bucket = _onl_bucket(&node->ipv6);
+
+        node->bucket_next = *bucket;
+        *bucket = node;
+    }
+}
+
+void _nib_onl_unindex(_nib_onl_entry_t *node)
+{
+    if (!ipv6_addr_is_unspecified(&node->ipv6)) {
+        for (_nib_onl_entry_t **ptr = _onl_bucket(&node->ipv6); *ptr != NULL;
+             ptr = &(*ptr)->bucket_next) {
+            if (*ptr == node) {
+                *ptr = node->bucket_next;
+                node->bucket_next = NULL;
+                return;
+            }
+        }
+    }
+}
+
+/* same result as searching _nodes for the first match, but only looks at
+ * the entries with the same address */
+static _nib_onl_entry_t *_onl_bucket_get(const ipv6_addr_t *addr,
+                                         unsigned iface, bool any_iface)
+{
+    _nib_onl_entry_t *res = NULL;
+
+    for (_nib_onl_entry_t *node = *_onl_bucket(addr); node != NULL;
+         node = node->bucket_next) {
+        unsigned node_iface = _nib_onl_get_if(node);
+
+        if (((res == NULL) || (node < res)) &&
+            ipv6_addr_equal(&node->ipv6, addr) &&
+            ((any_iface) ? ((node->mode != _EMPTY) &&
+                            ((node_iface == 0) || (iface == 0) ||
+                             (node_iface == iface)))
+                         : (node_iface == iface))) {
+            res = node;
+        }
+    }
+    return res;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
+static void _set_addr(_nib_onl_entry_t *node, const ipv6_addr_t *addr)
+{
+    if (!ipv6_addr_equal(&node->ipv6, addr)) {
+        _nib_onl_unindex(node);
+        memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+        _onl_index(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+    }
+}
+
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
@@ -94,6 +183,15 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    /* an existing entry for the address is preferred over reusing one with
+     * unspecified address; only new entries need to search all of _nodes */
+    if ((addr != NULL) && !ipv6_addr_is_unspecified(addr) &&
+        ((node = _onl_bucket_get(addr, iface, false)) != NULL)) {
+        DEBUG("  %p is an exact match\n", (void *)node);
+    }
+    else
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -109,6 +207,9 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
         }
     }
     if (node != NULL) {
+        if (node->mode == _EMPTY) {
+            _nib_changed();
+        }
         _override_node(addr, iface, node);
     }
     else {
@@ -124,12 +225,68 @@ static inline bool _is_gc(_nib_onl_entry_t *node)
             GNRC_IPV6_NIB_NC_INFO_AR_STATE_GC);
 }
 
+/* Removable entries are kept in a clist as FIFO. With the address index they
+ * are also linked backwards, so an entry can be unlinked in constant time. */
+static inline void _removable_push(_nib_onl_entry_t *node)
+{
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    _nib_onl_entry_t *tail = (_nib_onl_entry_t *)_next_removable.next;
+
+    clist_rpush(&_next_removable, (clist_node_t *)node);
+    node->prev = (tail != NULL) ? tail : node;
+    node->next->prev = node;
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+    clist_rpush(&_next_removable, (clist_node_t *)node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+}
+
+static inline _nib_onl_entry_t *_removable_pop(void)
+{
+    _nib_onl_entry_t *node = (_nib_onl_entry_t *)clist_lpop(&_next_removable);
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    if (node != NULL) {
+        _nib_onl_entry_t *tail = (_nib_onl_entry_t *)_next_removable.next;
+
+        if (tail != NULL) {
+            tail->next->prev = tail;
+        }
+        node->next = NULL;
+        node->prev = NULL;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+    return node;
+}
+
+static inline void _removable_remove(_nib_onl_entry_t *node)
+{
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    if (node->next == NULL) {
+        return;
+    }
+    if (node->next == node) {
+        _next_removable.next = NULL;
+    }
+    else {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        if (_next_removable.next == (clist_node_t *)node) {
+            _next_removable.next = (clist_node_t *)node->prev;
+        }
+    }
+    node->next = NULL;
+    node->prev = NULL;
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+    clist_remove(&_next_removable, (clist_node_t *)node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+}
+
 static inline _nib_onl_entry_t *_cache_out_onl_entry(const ipv6_addr_t *addr,
                                                      unsigned iface,
                                                      uint16_t cstate)
 {
     /* Use clist as FIFO for caching */
-    _nib_onl_entry_t *first = (_nib_onl_entry_t *)clist_lpop(&_next_removable);
+    _nib_onl_entry_t *first = _removable_pop();
     _nib_onl_entry_t *tmp = first, *res = NULL;
 
     DEBUG("nib: Searching for replaceable entries (addr = %s, iface = %u)\n",
@@ -158,15 +315,15 @@ static inline _nib_onl_entry_t *_cache_out_onl_entry(const ipv6_addr_t *addr,
         /* requeue if not garbage collectible at the moment or queueing
          * newly created NCE or in case entry becomes garbage collectible
          * again */
-        clist_rpush(&_next_removable, (clist_node_t *)tmp);
+        _removable_push(tmp);
         if (res == NULL) {
             /* no new entry created yet, get next entry in FIFO */
-            tmp = (_nib_onl_entry_t *)clist_lpop(&_next_removable);
+            tmp = _removable_pop();
         }
     } while ((tmp != first) && (res == NULL));
     if (res == NULL) {
         /* we did not find any removable entry => requeue current one */
-        clist_rpush(&_next_removable, (clist_node_t *)tmp);
+        _removable_push(tmp);
     }
     return res;
 }
@@ -190,12 +347,13 @@ _nib_onl_entry_t *_nib_nc_add(const ipv6_addr_t *addr, unsigned iface,
         /* masked above already */
         node->info |= cstate;
         node->mode |= _NC;
+        _nib_changed();
     }
     if (node->next == NULL) {
         DEBUG("nib: queueing (addr = %s, iface = %u) for potential removal\n",
               ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
         /* add to next removable list, if not already in it */
-        clist_rpush(&_next_removable, (clist_node_t *)node);
+        _removable_push(node);
     }
     return node;
 }
@@ -219,6 +377,14 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    if (!ipv6_addr_is_unspecified(addr)) {
+        _nib_onl_entry_t *node = _onl_bucket_get(addr, iface, true);
+
+        DEBUG("  Found %p\n", (void *)node);
+        return node;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
@@ -241,8 +407,19 @@ void _nib_nc_set_reachable(_nib_onl_entry_t *node)
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
     gnrc_netif_t *netif = gnrc_netif_get_by_pid(_nib_onl_get_if(node));
 
-    node->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
-    node->info |= GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE;
+    if ((node->info & GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK) !=
+        GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE) {
+        node->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
+        node->info |= GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE;
+        _nib_changed();
+    }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    if (node->next != NULL) {
+        /* keep the cache-out FIFO in least-recently-reachable order */
+        _removable_remove(node);
+        _removable_push(node);
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
 #ifdef TEST_SUITES
     /* exit early for unittests */
     if (netif == NULL) {
@@ -265,6 +442,7 @@ void _nib_nc_remove(_nib_onl_entry_t *node)
           ipv6_addr_to_str(addr_str, &node->ipv6, sizeof(addr_str)),
           _nib_onl_get_if(node));
     node->mode &= ~(_NC);
+    _nib_changed();
     evtimer_del((evtimer_t *)&_nib_evtimer, &node->snd_na.event);
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
     evtimer_del((evtimer_t *)&_nib_evtimer, &node->nud_timeout.event);
@@ -288,7 +466,7 @@ void _nib_nc_remove(_nib_onl_entry_t *node)
     }
 #endif  /* CONFIG_GNRC_IPV6_NIB_QUEUE_PKT */
     /* remove from cache-out procedure */
-    clist_remove(&_next_removable, (clist_node_t *)node);
+    _removable_remove(node);
     _nib_onl_clear(node);
 }
 
@@ -353,7 +531,10 @@ _nib_dr_entry_t *_nib_drl_add(const ipv6_addr_t *router_addr, unsigned iface)
             (ipv6_addr_equal(router_addr, &tmp_node->ipv6))) {
             /* exact match */
             DEBUG("  %p is an exact match\n", (void *)tmp);
-            tmp_node->mode |= _DRL;
+            if (!(tmp_node->mode & _DRL)) {
+                tmp_node->mode |= _DRL;
+                _nib_changed();
+            }
             return tmp;
         }
         if ((def_router == NULL) && (tmp_node == NULL)) {
@@ -369,6 +550,7 @@ _nib_dr_entry_t *_nib_drl_add(const ipv6_addr_t *router_addr, unsigned iface)
         }
         _override_node(router_addr, iface, def_router->next_hop);
         def_router->next_hop->mode |= _DRL;
+        _nib_changed();
     }
     return def_router;
 }
@@ -377,11 +559,12 @@ void _nib_drl_remove(_nib_dr_entry_t *nib_dr)
 {
     if (nib_dr->next_hop != NULL) {
         nib_dr->next_hop->mode &= ~(_DRL);
+        _nib_changed();
         _nib_onl_clear(nib_dr->next_hop);
         memset(nib_dr, 0, sizeof(_nib_dr_entry_t));
     }
     if (nib_dr == _prime_def_router) {
-        _prime_def_router = NULL;
+        _nib_drl_set_prime(NULL);
     }
 }
 
@@ -441,18 +624,17 @@ _nib_dr_entry_t *_nib_drl_get_dr(void)
             if ((_prime_def_router == NULL) || (next == NULL)) {
                 /* wrap around to first (potentially unreachable) route
                  * to trigger NUD for it */
-                _prime_def_router = _nib_drl_iter(NULL);
+                _nib_drl_set_prime(_nib_drl_iter(NULL));
             }
             /* there is another default router, choose it regardless of
              * reachability to potentially trigger NUD for it */
             else if (next != NULL) {
-                _prime_def_router = next;
+                _nib_drl_set_prime(next);
             }
             return _prime_def_router;
         }
     } while (_node_unreachable(ptr->next_hop));
-    _prime_def_router = ptr;
-    return _prime_def_router;
+    return _nib_drl_set_prime(ptr);
 }
 
 void _nib_drl_ft_get(const _nib_dr_entry_t *drl, gnrc_ipv6_nib_ft_t *fte)
@@ -492,8 +674,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             (ipv6_addr_match_prefix(&tmp->pfx, pfx) >= pfx_len)) {  /* the prefix matches */
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
-            if (next_hop != NULL) {
-                memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+            if ((next_hop != NULL) && ipv6_addr_is_unspecified(&tmp_node->ipv6)) {
+                _set_addr(tmp_node, next_hop);
+                _nib_changed();
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -514,6 +697,8 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _nib_offl_trie_add(dst);
+        _nib_changed();
     }
     return dst;
 }
@@ -550,7 +735,9 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+        _nib_offl_trie_del(dst);
         memset(dst, 0, sizeof(_nib_offl_entry_t));
+        _nib_changed();
     }
 }
 
@@ -575,11 +762,14 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
-    _nib_offl_entry_t *res = NULL;
-    uint8_t best_match = 0;
-
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_FT_TRIE)
+    return _nib_offl_trie_get_match(dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_FT_TRIE */
+    _nib_offl_entry_t *res = NULL;
+    uint8_t best_len = 0;
+
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -592,14 +782,16 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
                   ipv6_addr_to_str(addr_str, &entry->next_hop->ipv6,
                                    sizeof(addr_str)),
                   _nib_onl_get_if(entry->next_hop), match);
-            if ((match > best_match) && (match >= entry->pfx_len)) {
+            /* the longest matching prefix wins, the first one on a tie */
+            if ((match >= entry->pfx_len) && (entry->pfx_len > best_len)) {
                 DEBUG("nib: best match (%u bits)\n", match);
                 res = entry;
-                best_match = match;
+                best_len = entry->pfx_len;
             }
         }
     }
     return res;
+#endif  /* CONFIG_GNRC_IPV6_NIB_FT_TRIE */
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -826,7 +1018,7 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
 {
     _nib_onl_clear(node);
     if (addr != NULL) {
-        memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+        _set_addr(node, addr);
     }
     _nib_onl_set_if(node, iface);
 }
@@ -93,6 +93,22 @@ extern "C" {
  */
 typedef struct _nib_onl_entry {
     struct _nib_onl_entry *next;        /**< next removable entry */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH) || defined(DOXYGEN)
+    /**
+     * @brief   next entry in the same bucket of the address index
+     *
+     * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_NC_HASH != 0.
+     */
+    struct _nib_onl_entry *bucket_next;
+    /**
+     * @brief   previous removable entry
+     *
+     * Allows to move an entry within the removable entries in constant time.
+     *
+     * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_NC_HASH != 0.
+     */
+    struct _nib_onl_entry *prev;
+#endif
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_QUEUE_PKT) || defined(DOXYGEN)
     /**
      * @brief   queue for packets currently in address resolution
@@ -248,6 +264,14 @@ typedef struct {
  */
 extern evtimer_msg_t _nib_evtimer;
 
+/**
+ * @brief   Generation of the NIB
+ *
+ * Incremented by @ref _nib_changed(). Use @ref gnrc_ipv6_nib_gen() to read it
+ * from outside the NIB.
+ */
+extern uint32_t _nib_gen;
+
 /**
  * @brief   Primary default router.
  *
@@ -273,6 +297,32 @@ void _nib_acquire(void);
  */
 void _nib_release(void);
 
+/**
+ * @brief   Advances the generation of the NIB
+ *
+ * Must be called on every change that might change the result of a lookup:
+ * allocating or clearing an entry, changing the NUD, 6LoWPAN-ND or IsRouter
+ * state or link-layer address of a neighbor, and updating the prefix list or
+ * the default router list.
+ */
+void _nib_changed(void);
+
+/**
+ * @brief   Sets the primary default router
+ *
+ * @param[in] dr    The new primary default router. May be NULL.
+ *
+ * @return  @p dr
+ */
+static inline _nib_dr_entry_t *_nib_drl_set_prime(_nib_dr_entry_t *dr)
+{
+    if (dr != _prime_def_router) {
+        _prime_def_router = dr;
+        _nib_changed();
+    }
+    return dr;
+}
+
 /**
  * @brief   Gets interface identifier from a NIB entry
  *
@@ -311,6 +361,19 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH) || defined(DOXYGEN)
+/**
+ * @brief   Removes an on-link entry from the address index
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_NC_HASH != 0.
+ *
+ * @param[in,out] node  An entry.
+ */
+void _nib_onl_unindex(_nib_onl_entry_t *node);
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+#define _nib_onl_unindex(node)  (void)node
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -322,7 +385,9 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+        _nib_onl_unindex(node);
         memset(node, 0, sizeof(_nib_onl_entry_t));
+        _nib_changed();
         return true;
     }
     return false;
@@ -570,8 +635,9 @@ static inline _nib_offl_entry_t *_nib_offl_add(const ipv6_addr_t *next_hop,
 {
     _nib_offl_entry_t *nib_offl = _nib_offl_alloc(next_hop, iface, pfx, pfx_len);
 
-    if (nib_offl != NULL) {
+    if ((nib_offl != NULL) && ((nib_offl->mode & mode) != mode)) {
         nib_offl->mode |= mode;
+        _nib_changed();
     }
     return nib_offl;
 }
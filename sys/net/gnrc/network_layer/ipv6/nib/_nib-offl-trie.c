@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <string.h>
+#include <kernel_defines.h>
+
+#include "bitfield.h"
+
+#include "_nib-offl-trie.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_FT_TRIE)
+
+/**
+ * @brief   Node of the trie
+ *
+ * A node with an off-link entry stands for the prefix of that entry. A node
+ * without one is a glue node that always has two children. Nodes with neither
+ * an off-link entry nor children are unused.
+ */
+typedef struct _trie_node {
+    struct _trie_node *child[2];    /**< sub-tries for the next bit 0 and 1 */
+    _nib_offl_entry_t *entry;       /**< off-link entry of the prefix */
+    uint8_t len;                    /**< prefix length / bit to branch on */
+} _trie_node_t;
+
+/* a binary trie with n prefix nodes needs at most n - 1 glue nodes */
+static _trie_node_t _nodes[(2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF) - 1];
+static _trie_node_t *_root = NULL;
+
+static inline bool _node_unused(const _trie_node_t *node)
+{
+    return (node->entry == NULL) && (node->child[0] == NULL);
+}
+
+static _trie_node_t *_node_alloc(_nib_offl_entry_t *entry, uint8_t len)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_nodes); i++) {
+        _trie_node_t *node = &_nodes[i];
+
+        if (_node_unused(node)) {
+            node->entry = entry;
+            node->len = len;
+            return node;
+        }
+    }
+    /* can't happen due to the size of _nodes */
+    assert(false);
+    return NULL;
+}
+
+static inline void _node_free(_trie_node_t *node)
+{
+    memset(node, 0, sizeof(*node));
+}
+
+static inline unsigned _bit(const ipv6_addr_t *addr, uint8_t pos)
+{
+    return bf_isset((uint8_t *)addr->u8, pos) ? 1U : 0U;
+}
+
+/* the bits of a node up to node->len are the ones of all prefixes below it */
+static const ipv6_addr_t *_node_key(const _trie_node_t *node)
+{
+    while (node->entry == NULL) {
+        node = node->child[0];
+    }
+    return &node->entry->pfx;
+}
+
+static inline uint8_t _common_len(const ipv6_addr_t *a, const ipv6_addr_t *b,
+                                  uint8_t max_len)
+{
+    uint8_t match = ipv6_addr_match_prefix(a, b);
+
+    return (match < max_len) ? match : max_len;
+}
+
+void _nib_offl_trie_init(void)
+{
+    memset(_nodes, 0, sizeof(_nodes));
+    _root = NULL;
+}
+
+void _nib_offl_trie_add(_nib_offl_entry_t *dst)
+{
+    _trie_node_t **link = &_root;
+
+    assert((dst != NULL) && (dst->pfx_len > 0));
+    const uint8_t len = dst->pfx_len;
+
+    while (*link != NULL) {
+        _trie_node_t *node = *link;
+        const ipv6_addr_t *key = _node_key(node);
+        uint8_t common = _common_len(key, &dst->pfx,
+                                     (len < node->len) ? len : node->len);
+
+        if (common == node->len) {
+            if (len == node->len) {
+                /* glue node becomes prefix node or entry with same prefix:
+                 * keep the first entry in NIB to match the linear search */
+                if ((node->entry == NULL) || (dst < node->entry)) {
+                    node->entry = dst;
+                }
+                return;
+            }
+            link = &node->child[_bit(&dst->pfx, node->len)];
+        }
+        else {
+            _trie_node_t *parent;
+
+            if (common == len) {
+                /* new prefix covers node */
+                parent = _node_alloc(dst, len);
+            }
+            else {
+                /* new prefix and node diverge at bit common */
+                _trie_node_t *leaf = _node_alloc(dst, len);
+
+                /* allocate glue node last: it is marked unused until it
+                 * gets its children */
+                parent = _node_alloc(NULL, common);
+                parent->child[_bit(&dst->pfx, common)] = leaf;
+            }
+            parent->child[_bit(key, parent->len)] = node;
+            *link = parent;
+            return;
+        }
+    }
+    *link = _node_alloc(dst, len);
+}
+
+void _nib_offl_trie_del(const _nib_offl_entry_t *dst)
+{
+    _trie_node_t **parent_link = NULL;
+    _trie_node_t **link = &_root;
+
+    assert((dst != NULL) && (dst->pfx_len > 0));
+    const uint8_t len = dst->pfx_len;
+
+    while ((*link != NULL) && ((*link)->len < len)) {
+        parent_link = link;
+        link = &(*link)->child[_bit(&dst->pfx, (*link)->len)];
+    }
+    _trie_node_t *node = *link;
+
+    if ((node == NULL) || (node->entry != dst)) {
+        /* dst was shadowed by an entry with the same prefix */
+        return;
+    }
+    /* promote another entry with the same prefix */
+    for (_nib_offl_entry_t *ptr = _nib_offl_iter(NULL); ptr != NULL;
+         ptr = _nib_offl_iter(ptr)) {
+        if ((ptr != dst) && (ptr->pfx_len == len) &&
+            (ipv6_addr_match_prefix(&ptr->pfx, &dst->pfx) >= len)) {
+            node->entry = ptr;
+            return;
+        }
+    }
+    if ((node->child[0] != NULL) && (node->child[1] != NULL)) {
+        node->entry = NULL;
+        return;
+    }
+    *link = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    _node_free(node);
+    if ((*link == NULL) && (parent_link != NULL) &&
+        ((*parent_link)->entry == NULL)) {
+        /* glue node lost one of its children => replace it by the other */
+        _trie_node_t *parent = *parent_link;
+
+        *parent_link = (parent->child[0] != NULL) ? parent->child[0]
+                                                  : parent->child[1];
+        _node_free(parent);
+    }
+}
+
+_nib_offl_entry_t *_nib_offl_trie_get_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+    const _trie_node_t *node = _root;
+
+    while (node != NULL) {
+        if (node->entry != NULL) {
+            if (ipv6_addr_match_prefix(&node->entry->pfx, dst) < node->len) {
+                /* all prefixes further down share the mismatching bits */
+                break;
+            }
+            if (node->entry->mode != _EMPTY) {
+                res = node->entry;
+            }
+        }
+        if (node->len >= IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        node = node->child[_bit(dst, node->len)];
+    }
+    DEBUG("nib: trie lookup yielded %p\n", (void *)res);
+    return res;
+}
+#else  /* CONFIG_GNRC_IPV6_NIB_FT_TRIE */
+typedef int dont_be_pedantic;
+#endif /* CONFIG_GNRC_IPV6_NIB_FT_TRIE */
+
+/** @} */
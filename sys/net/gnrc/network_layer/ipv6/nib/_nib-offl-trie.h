@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @internal
+ * @{
+ *
+ * @file
+ * @brief   Longest-prefix-match index over the off-link entries of NIB
+ *
+ * The index is a path-compressed binary trie. Nodes either stand for the
+ * prefix of one or more off-link entries or are glue nodes at the bit where
+ * two sub-tries diverge. Only the prefix nodes are checked against the
+ * destination during a lookup, so a lookup costs at most one prefix
+ * comparison per prefix on the path to the destination, regardless of the
+ * number of off-link entries.
+ */
+#ifndef PRIV_NIB_OFFL_TRIE_H
+#define PRIV_NIB_OFFL_TRIE_H
+
+#include <kernel_defines.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_FT_TRIE) || defined(DOXYGEN)
+/**
+ * @brief   Empties the index
+ */
+void _nib_offl_trie_init(void);
+
+/**
+ * @brief   Adds an off-link entry to the index
+ *
+ * @pre `(dst != NULL) && (dst->pfx_len > 0)`
+ *
+ * @param[in] dst   A newly allocated off-link entry.
+ */
+void _nib_offl_trie_add(_nib_offl_entry_t *dst);
+
+/**
+ * @brief   Removes an off-link entry from the index
+ *
+ * If another off-link entry has the same prefix it takes the place of @p dst.
+ *
+ * @pre `(dst != NULL) && (dst->pfx_len > 0)`
+ *
+ * @param[in] dst   An off-link entry that is about to be cleared.
+ */
+void _nib_offl_trie_del(const _nib_offl_entry_t *dst);
+
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching @p dst
+ *
+ * If there are multiple entries with that prefix, the first one in NIB is
+ * returned.
+ *
+ * @param[in] dst   A destination address.
+ *
+ * @return  The best matching off-link entry.
+ * @return  NULL, if no off-link entry matches @p dst.
+ */
+_nib_offl_entry_t *_nib_offl_trie_get_match(const ipv6_addr_t *dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_FT_TRIE */
+#define _nib_offl_trie_init()           (void)0
+#define _nib_offl_trie_add(dst)         (void)dst
+#define _nib_offl_trie_del(dst)         (void)dst
+#endif  /* CONFIG_GNRC_IPV6_NIB_FT_TRIE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_NIB_OFFL_TRIE_H */
+/** @} */
@@ -18,6 +18,7 @@
 #include <stdbool.h>
 #include <kernel_defines.h>
 
+#include "irq.h"
 #include "log.h"
 #include "net/ipv6/addr.h"
 #include "net/gnrc/icmpv6/error.h"
@@ -290,6 +291,15 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
     return res;
 }
 
+uint32_t gnrc_ipv6_nib_gen(void)
+{
+    unsigned state = irq_disable();
+    uint32_t gen = _nib_gen;
+
+    irq_restore(state);
+    return gen;
+}
+
 void gnrc_ipv6_nib_handle_pkt(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
                               const icmpv6_hdr_t *icmpv6, size_t icmpv6_len)
 {
@@ -1539,8 +1549,10 @@ static uint32_t _handle_pio(gnrc_netif_t *netif, const icmpv6_hdr_t *icmpv6,
                 _nib_abr_add_pfx(abr, pfx);
             }
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
-            if (pio->flags & NDP_OPT_PI_FLAGS_L) {
+            if ((pio->flags & NDP_OPT_PI_FLAGS_L) &&
+                !(pfx->flags & _PFX_ON_LINK)) {
                 pfx->flags |= _PFX_ON_LINK;
+                _nib_changed();
             }
             if (pio->flags & NDP_OPT_PI_FLAGS_A) {
                 pfx->flags |= _PFX_SLAAC;
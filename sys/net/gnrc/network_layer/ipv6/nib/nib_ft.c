@@ -54,7 +54,7 @@ int gnrc_ipv6_nib_ft_add(const ipv6_addr_t *dst, unsigned dst_len,
             res = -ENOMEM;
         }
         else {
-            _prime_def_router = ptr;
+            _nib_drl_set_prime(ptr);
             if (ltime > 0) {
                 _evtimer_add(ptr, GNRC_IPV6_NIB_RTR_TIMEOUT,
                              &ptr->rtr_timeout, ltime * MS_PER_SEC);
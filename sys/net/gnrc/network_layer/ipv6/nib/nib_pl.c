@@ -66,8 +66,10 @@ int gnrc_ipv6_nib_pl_set(unsigned iface,
      */
     if ((!gnrc_netif_is_6ln(netif) || gnrc_netif_is_6lbr(netif)) &&
         ((idx = gnrc_netif_ipv6_addr_match(netif, pfx)) >= 0) &&
-        (ipv6_addr_match_prefix(&netif->ipv6.addrs[idx], pfx) >= pfx_len)) {
+        (ipv6_addr_match_prefix(&netif->ipv6.addrs[idx], pfx) >= pfx_len) &&
+        !(dst->flags & _PFX_ON_LINK)) {
         dst->flags |= _PFX_ON_LINK;
+        _nib_changed();
     }
     if (netif->ipv6.aac_mode == GNRC_NETIF_AAC_AUTO) {
         dst->flags |= _PFX_SLAAC;
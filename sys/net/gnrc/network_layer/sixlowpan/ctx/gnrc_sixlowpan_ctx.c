@@ -14,7 +14,9 @@
 
 #include <stdbool.h>
 #include <inttypes.h>
+#include <string.h>
 
+#include "irq.h"
 #include "mutex.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #include "xtimer.h"
@@ -22,37 +24,103 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* lifetimes are given in minutes, the unittests shorten the minute */
+#ifndef GNRC_SIXLOWPAN_CTX_LTIME_TICK_US
+#define GNRC_SIXLOWPAN_CTX_LTIME_TICK_US    (60U * US_PER_SEC)
+#endif
+
 static gnrc_sixlowpan_ctx_t _ctxs[GNRC_SIXLOWPAN_CTX_SIZE];
-static uint32_t _ctx_inval_times[GNRC_SIXLOWPAN_CTX_SIZE];
+/* IDs of the valid contexts ordered by decreasing prefix length, so the first
+ * context in there matching an address is the best one for it */
+static uint8_t _ctx_idx[GNRC_SIXLOWPAN_CTX_SIZE];
+/* prefix lengths of the contexts when _ctx_idx was built, to detect
+ * contexts removed with gnrc_sixlowpan_ctx_remove() */
+static uint8_t _ctx_idx_lens[GNRC_SIXLOWPAN_CTX_SIZE];
+static uint8_t _ctx_idx_numof;
 static mutex_t _ctx_mutex = MUTEX_INIT;
 
-static uint32_t _current_minute(void);
-static void _update_lifetime(uint8_t id);
+static void _ltime_tick(void *arg);
+
+static xtimer_t _ltime_timer = { .callback = _ltime_tick };
+static bool _ltime_timer_set;
 
 static char ipv6str[IPV6_ADDR_MAX_STR_LEN];
 
 static inline bool _valid(uint8_t id)
 {
-    _update_lifetime(id);
     return (_ctxs[id].prefix_len > 0);
 }
 
+static bool _match(const gnrc_sixlowpan_ctx_t *ctx, const ipv6_addr_t *addr)
+{
+    unsigned bytes = ctx->prefix_len / 8U;
+    unsigned bits = ctx->prefix_len % 8U;
+
+    if (memcmp(&ctx->prefix, addr, bytes) != 0) {
+        return false;
+    }
+    /* bits of the prefix beyond prefix_len are always unset */
+    return (bits == 0) ||
+           ((addr->u8[bytes] & (uint8_t)(0xff << (8U - bits))) ==
+            ctx->prefix.u8[bytes]);
+}
+
+static bool _shadowed(uint8_t id)
+{
+    /* a context with a lower ID and the same, but not longer prefix matches
+     * every address this one matches equally well, so it is always preferred */
+    for (uint8_t i = 0; i < id; i++) {
+        if (_valid(i) && (_ctxs[i].prefix_len <= _ctxs[id].prefix_len) &&
+            ipv6_addr_equal(&_ctxs[i].prefix, &_ctxs[id].prefix)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void _build_idx(void)
+{
+    _ctx_idx_numof = 0;
+    for (uint8_t id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+        uint8_t prefix_len = _ctxs[id].prefix_len;
+        unsigned pos = _ctx_idx_numof;
+
+        _ctx_idx_lens[id] = prefix_len;
+        if (!_valid(id) || _shadowed(id)) {
+            continue;
+        }
+        /* behind contexts with an equally long prefix, so ties go to the
+         * lower ID */
+        while ((pos > 0) && (_ctxs[_ctx_idx[pos - 1]].prefix_len < prefix_len)) {
+            _ctx_idx[pos] = _ctx_idx[pos - 1];
+            pos--;
+        }
+        _ctx_idx[pos] = id;
+        _ctx_idx_numof++;
+    }
+}
+
 gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_addr(const ipv6_addr_t *addr)
 {
-    uint8_t best = 0;
     gnrc_sixlowpan_ctx_t *res = NULL;
+    unsigned i = 0;
 
     mutex_lock(&_ctx_mutex);
 
-    for (unsigned int id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
-        if (_valid(id)) {
-            uint8_t match = ipv6_addr_match_prefix(&_ctxs[id].prefix, addr);
+    while (i < _ctx_idx_numof) {
+        uint8_t id = _ctx_idx[i];
 
-            if ((_ctxs[id].prefix_len <= match) && (match > best)) {
-                best = match;
-                res = &(_ctxs[id]);
-            }
+        if (_ctxs[id].prefix_len != _ctx_idx_lens[id]) {
+            DEBUG("6lo ctx: context %u was removed, rebuilding index\n", id);
+            _build_idx();
+            i = 0;
+            continue;
+        }
+        if (_match(&_ctxs[id], addr)) {
+            res = &(_ctxs[id]);
+            break;
         }
+        i++;
     }
 
     mutex_unlock(&_ctx_mutex);
@@ -95,72 +163,80 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
                                                 uint8_t prefix_len, uint16_t ltime,
                                                 bool comp)
 {
+    unsigned state;
+
     if ((id >= GNRC_SIXLOWPAN_CTX_SIZE) || (prefix_len == 0)) {
         return NULL;
     }
 
     mutex_lock(&_ctx_mutex);
 
-    _ctxs[id].ltime = ltime;
-
     if (ltime == 0) {
         comp = false;
     }
 
     if (prefix_len > IPV6_ADDR_BIT_LEN) {
-        _ctxs[id].prefix_len = IPV6_ADDR_BIT_LEN;
-    }
-    else {
-        _ctxs[id].prefix_len = prefix_len;
+        prefix_len = IPV6_ADDR_BIT_LEN;
     }
 
+    /* lifetime and flags are also changed by _ltime_tick() */
+    state = irq_disable();
+    _ctxs[id].ltime = ltime;
+    _ctxs[id].prefix_len = prefix_len;
     _ctxs[id].flags_id = (comp) ? (GNRC_SIXLOWPAN_CTX_FLAGS_COMP | id) : id;
-
-    if (!ipv6_addr_equal(&(_ctxs[id].prefix), prefix)) {
-        ipv6_addr_set_unspecified(&(_ctxs[id].prefix));
-        ipv6_addr_init_prefix(&(_ctxs[id].prefix), prefix, _ctxs[id].prefix_len);
+    if ((ltime > 0) && !_ltime_timer_set) {
+        _ltime_timer_set = true;
+        xtimer_set(&_ltime_timer, GNRC_SIXLOWPAN_CTX_LTIME_TICK_US);
     }
+    irq_restore(state);
+
+    /* also when only the prefix length changed, so no bits beyond it stay
+     * set */
+    ipv6_addr_set_unspecified(&(_ctxs[id].prefix));
+    ipv6_addr_init_prefix(&(_ctxs[id].prefix), prefix, _ctxs[id].prefix_len);
     DEBUG("6lo ctx: update context (%u, %s/%" PRIu8 "), lifetime: %" PRIu16 " min\n",
           id, ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
           _ctxs[id].prefix_len, _ctxs[id].ltime);
-    _ctx_inval_times[id] = ltime + _current_minute();
+    _build_idx();
 
     mutex_unlock(&_ctx_mutex);
     return &(_ctxs[id]);
 }
 
-static uint32_t _current_minute(void)
+static void _ltime_tick(void *arg)
 {
-    return xtimer_now_usec() / (US_PER_SEC * 60);
-}
-
-static void _update_lifetime(uint8_t id)
-{
-    uint32_t now;
-
-    if (_ctxs[id].ltime == 0) {
-        _ctxs[id].flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
-        return;
-    }
-
-    now = _current_minute();
-
-    if (now >= _ctx_inval_times[id]) {
-        DEBUG("6lo ctx: context %u was invalidated for compression\n", id);
-        _ctxs[id].ltime = 0;
-        _ctxs[id].flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
+    bool running = false;
+
+    (void)arg;
+    /* called in interrupt context, so the context buffer can't be locked;
+     * gnrc_sixlowpan_ctx_update() disables interrupts instead */
+    for (unsigned id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+        if (!_valid(id) || (_ctxs[id].ltime == 0)) {
+            continue;
+        }
+        if (--_ctxs[id].ltime == 0) {
+            /* context is still valid for decompression */
+            _ctxs[id].flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
+        }
+        else {
+            running = true;
+        }
     }
-    else {
-        _ctxs[id].ltime = (uint16_t)(_ctx_inval_times[id] - now);
+    _ltime_timer_set = running;
+    if (running) {
+        xtimer_set(&_ltime_timer, GNRC_SIXLOWPAN_CTX_LTIME_TICK_US);
     }
 }
 
 #ifdef TEST_SUITES
-#include <string.h>
-
 void gnrc_sixlowpan_ctx_reset(void)
 {
+    mutex_lock(&_ctx_mutex);
+    xtimer_remove(&_ltime_timer);
+    _ltime_timer_set = false;
     memset(_ctxs, 0, sizeof(_ctxs));
+    _build_idx();
+    mutex_unlock(&_ctx_mutex);
 }
 #endif
 
@@ -284,6 +284,10 @@ void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
         goto error;
     }
     fbuf->offset += res;
+#ifdef MODULE_NETSTATS_L2
+    /* the payload of every fragment is copied out of the datagram */
+    iface->stats.tx_copied_bytes += res;
+#endif
     if (!gnrc_sixlowpan_frag_fb_send(fbuf)) {
         DEBUG("6lo frag: message queue full, can't issue next fragment "
               "sending\n");
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/internal.h"
+#ifdef  MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+#include "net/gnrc/sixlowpan/frag/stats.h"
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_STATS */
+#include "net/sixlowpan.h"
+
+#include "net/gnrc/sixlowpan/frag/minfwd.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static inline bool _fits(size_t size, const gnrc_netif_t *netif)
+{
+    return (netif->sixlo.max_frag_size == 0) ||
+           (size <= netif->sixlo.max_frag_size);
+}
+
+/* rewrites a single netif header snip for the next hop of vrbe */
+static gnrc_pktsnip_t *_next_hop_netif_hdr(gnrc_pktsnip_t *netif,
+                                           const gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    const size_t size = sizeof(gnrc_netif_hdr_t) + vrbe->super.dst_len;
+    gnrc_pktsnip_t *tmp;
+    gnrc_netif_hdr_t *hdr;
+
+    assert(netif->next == NULL);
+    /* only copied if still in use elsewhere, e.g. held by
+     * gnrc_sixlowpan_frag_recv() */
+    if ((tmp = gnrc_pktbuf_start_write(netif)) == NULL) {
+        gnrc_pktbuf_release(netif);
+        return NULL;
+    }
+    netif = tmp;
+    if ((netif->size != size) &&
+        (gnrc_pktbuf_realloc_data(netif, size) != 0)) {
+        gnrc_pktbuf_release(netif);
+        return NULL;
+    }
+    hdr = netif->data;
+    /* the outgoing interface fills in its own address as source */
+    gnrc_netif_hdr_init(hdr, 0, vrbe->super.dst_len);
+    gnrc_netif_hdr_set_dst_addr(hdr, vrbe->super.dst, vrbe->super.dst_len);
+    gnrc_netif_hdr_set_netif(hdr, vrbe->out_netif);
+    return netif;
+}
+
+static void _send(gnrc_pktsnip_t *pkt, unsigned page)
+{
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+    gnrc_sixlowpan_frag_stats_get()->fwd_fragments++;
+#endif
+    gnrc_sixlowpan_dispatch_send(pkt, NULL, page);
+}
+
+int gnrc_sixlowpan_frag_minfwd_forward(gnrc_pktsnip_t *pkt,
+                                       gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                       unsigned page)
+{
+    gnrc_pktsnip_t *netif, *tmp;
+    sixlowpan_frag_n_t *hdr;
+
+    assert(vrbe != NULL);
+    assert((pkt != NULL) && (pkt->next != NULL));
+    assert(pkt->next->type == GNRC_NETTYPE_NETIF);
+    if (!_fits(pkt->size, vrbe->out_netif)) {
+        DEBUG("6lo minfwd: fragment too big for interface %d\n",
+              vrbe->out_netif->pid);
+        gnrc_pktbuf_release(pkt);
+        return -EMSGSIZE;
+    }
+    if ((tmp = gnrc_pktbuf_start_write(pkt)) == NULL) {
+        DEBUG("6lo minfwd: unable to write-protect fragment\n");
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+    pkt = tmp;
+    netif = pkt->next;
+    pkt->next = NULL;
+    if ((netif = _next_hop_netif_hdr(netif, vrbe)) == NULL) {
+        DEBUG("6lo minfwd: unable to rewrite netif header\n");
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+    hdr = pkt->data;
+    hdr->tag = byteorder_htons(vrbe->out_tag);
+    DEBUG("6lo minfwd: forward fragment (offset: %u) with tag %u\n",
+          sixlowpan_frag_offset(hdr), vrbe->out_tag);
+    _send(gnrc_pkt_prepend(pkt, netif), page);
+    return 0;
+}
+
+int gnrc_sixlowpan_frag_minfwd_frag_iphc(gnrc_pktsnip_t *pkt,
+                                         gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                         unsigned page)
+{
+    gnrc_pktsnip_t *netif, *frag;
+    sixlowpan_frag_t *hdr;
+
+    assert(vrbe != NULL);
+    assert((pkt != NULL) && (pkt->type == GNRC_NETTYPE_NETIF));
+    netif = pkt;
+    pkt = pkt->next;
+    netif->next = NULL;
+    frag = gnrc_pktbuf_add(pkt, NULL, sizeof(sixlowpan_frag_t),
+                           GNRC_NETTYPE_SIXLOWPAN);
+    if (frag == NULL) {
+        DEBUG("6lo minfwd: unable to allocate fragmentation header\n");
+        gnrc_pktbuf_release(netif);
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+    if (!_fits(gnrc_pkt_len(frag), vrbe->out_netif)) {
+        /* recompression for the next hop grew the headers beyond what the
+         * link can carry */
+        DEBUG("6lo minfwd: recompressed fragment too big for interface %d\n",
+              vrbe->out_netif->pid);
+        gnrc_pktbuf_release(netif);
+        gnrc_pktbuf_release(frag);
+        return -EMSGSIZE;
+    }
+    if ((netif = _next_hop_netif_hdr(netif, vrbe)) == NULL) {
+        DEBUG("6lo minfwd: unable to rewrite netif header\n");
+        gnrc_pktbuf_release(frag);
+        return -ENOMEM;
+    }
+    hdr = frag->data;
+    hdr->disp_size = byteorder_htons(vrbe->super.datagram_size);
+    hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+    hdr->tag = byteorder_htons(vrbe->out_tag);
+    DEBUG("6lo minfwd: forward first fragment with tag %u\n", vrbe->out_tag);
+    _send(gnrc_pkt_prepend(frag, netif), page);
+    return 0;
+}
+
+/** @} */
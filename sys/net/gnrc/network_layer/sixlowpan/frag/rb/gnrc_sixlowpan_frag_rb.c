@@ -16,6 +16,7 @@
 #include <assert.h>
 #include <inttypes.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "net/ieee802154.h"
 #include "net/ipv6.h"
@@ -23,6 +24,9 @@
 #include "net/gnrc.h"
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/config.h"
+#ifdef  MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD
+#include "net/gnrc/sixlowpan/frag/minfwd.h"
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD */
 #ifdef  MODULE_GNRC_SIXLOWPAN_FRAG_STATS
 #include "net/gnrc/sixlowpan/frag/stats.h"
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_STATS */
@@ -57,6 +61,20 @@ static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+/* Entries are placed in rbuf by open addressing: a new entry takes the first
+ * free slot from the home slot of its (source, destination, tag) tuple on (see
+ * _rbuf_home()). _rbuf_probes[home] is the farthest an entry with that home
+ * slot may be from it, so lookups only need to check these slots.
+ * _rbuf_homes[i] is the home slot of the entry in rbuf[i]. */
+static uint16_t _rbuf_probes[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+static uint16_t _rbuf_homes[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+
+/* no entry in rbuf arrived earlier than this, if _rbuf_gc_pending is set. Only
+ * when it is older than CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US the garbage
+ * collection needs to check the entries */
+static uint32_t _rbuf_gc_arrival;
+static bool _rbuf_gc_pending;
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -81,6 +99,22 @@ static int _rbuf_get(const void *src, size_t src_len,
 /* gets an entry only by link-layer information and tag */
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag);
+/* gets the home slot of an entry in rbuf */
+static unsigned _rbuf_home(const uint8_t *src, size_t src_len,
+                           const uint8_t *dst, size_t dst_len,
+                           uint16_t tag);
+/* looks up an entry starting at its home slot */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_lookup(unsigned home,
+                                              const uint8_t *src, size_t src_len,
+                                              const uint8_t *dst, size_t dst_len,
+                                              size_t size, uint16_t tag);
+/* garbage collection run for every added fragment */
+static void _rbuf_gc_on_add(void);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD
+/* forwards a subsequent fragment of a datagram with a VRB entry */
+static int _forward_frag(gnrc_sixlowpan_frag_vrb_t *vrbe, gnrc_pktsnip_t *pkt,
+                         size_t frag_size, size_t offset, unsigned page);
+#endif
 /* internal add to repeat add when fragments overlapped */
 static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                      size_t offset, unsigned page);
@@ -91,8 +125,37 @@ enum {
     RBUF_ADD_ERROR = -1,
     RBUF_ADD_REPEAT = -2,
     RBUF_ADD_DUPLICATE = -3,
+    RBUF_ADD_FORWARDED = -4,
 };
 
+/* size parameter for _rbuf_lookup() to find an entry regardless of its
+ * datagram size */
+#define RBUF_ANY_SIZE   (SIZE_MAX)
+
+static inline unsigned _first_block(size_t offset)
+{
+    return offset / GNRC_SIXLOWPAN_FRAG_RB_BLOCK_SIZE;
+}
+
+/* block after the last block covered by a fragment */
+static inline unsigned _end_block(size_t offset, size_t frag_size)
+{
+    return (offset + frag_size + GNRC_SIXLOWPAN_FRAG_RB_BLOCK_SIZE - 1) /
+           GNRC_SIXLOWPAN_FRAG_RB_BLOCK_SIZE;
+}
+
+static bool _blocks_received(gnrc_sixlowpan_frag_rb_t *entry,
+                             size_t frag_size, size_t offset)
+{
+    for (unsigned i = _first_block(offset);
+         i < _end_block(offset, frag_size); i++) {
+        if (bf_isset(entry->received, i)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
                             size_t frag_size, size_t offset)
 {
@@ -119,6 +182,17 @@ static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
     return RBUF_ADD_SUCCESS;
 }
 
+static int _check_rbuf_fragments(gnrc_sixlowpan_frag_rb_t *entry,
+                                 size_t frag_size, size_t offset)
+{
+    /* as fragments start at block boundaries, a fragment can only overlap
+     * with another if they share a block */
+    if (!_blocks_received(entry, frag_size, offset)) {
+        return RBUF_ADD_SUCCESS;
+    }
+    return _check_fragments(&entry->super, frag_size, offset);
+}
+
 gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_add(gnrc_netif_hdr_t *netif_hdr,
                                                      gnrc_pktsnip_t *pkt,
                                                      size_t offset, unsigned page)
@@ -167,20 +241,69 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     const uint8_t src_len = netif_hdr->src_l2addr_len;
     const uint8_t dst_len = netif_hdr->dst_l2addr_len;
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
+    return _rbuf_lookup(_rbuf_home(src, src_len, dst, dst_len, tag),
+                        src, src_len, dst, dst_len, RBUF_ANY_SIZE, tag);
+}
+
+static uint32_t _fnv1a(uint32_t hash, const uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ buf[i]) * 16777619U;
+    }
+    return hash;
+}
 
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
+static unsigned _rbuf_home(const uint8_t *src, size_t src_len,
+                           const uint8_t *dst, size_t dst_len,
+                           uint16_t tag)
+{
+    /* the datagram size is not part of the hash, so entries can also be found
+     * by _rbuf_get_by_tag() */
+    uint32_t hash = _fnv1a(2166136261U, (uint8_t *)&tag, sizeof(tag));
+
+    hash = _fnv1a(hash, src, src_len);
+    hash = _fnv1a(hash, dst, dst_len);
+    return hash % CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE;
+}
+
+static gnrc_sixlowpan_frag_rb_t *_rbuf_lookup(unsigned home,
+                                              const uint8_t *src, size_t src_len,
+                                              const uint8_t *dst, size_t dst_len,
+                                              size_t size, uint16_t tag)
+{
+    unsigned probes = 0;
+
+    for (unsigned i = 0; i <= _rbuf_probes[home]; i++) {
+        unsigned idx = (home + i) % CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE;
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[idx];
+
+        if ((e->pkt == NULL) || (_rbuf_homes[idx] != home)) {
+            continue;
+        }
+        if (((size == RBUF_ANY_SIZE) || (e->super.datagram_size == size)) &&
+            (e->super.tag == tag) && (e->super.src_len == src_len) &&
             (e->super.dst_len == dst_len) &&
             (memcmp(e->super.src, src, src_len) == 0) &&
             (memcmp(e->super.dst, dst, dst_len) == 0)) {
             return e;
         }
+        probes = i;
     }
+    /* entries with this home slot may have been removed since, so only check
+     * as far as the remaining ones next time */
+    _rbuf_probes[home] = probes;
     return NULL;
 }
 
+static void _rbuf_gc_note_arrival(uint32_t arrival)
+{
+    if (!_rbuf_gc_pending ||
+        ((_rbuf_gc_arrival - arrival) < (UINT32_MAX / 2))) {
+        _rbuf_gc_arrival = arrival;
+        _rbuf_gc_pending = true;
+    }
+}
+
 #ifndef NDEBUG
 static bool _valid_offset(gnrc_pktsnip_t *pkt, size_t offset)
 {
@@ -235,7 +358,26 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     datagram_size = sixlowpan_frag_datagram_size(pkt->data);
     datagram_tag = sixlowpan_frag_datagram_tag(pkt->data);
 
-    gnrc_sixlowpan_frag_rb_gc();
+    if (frag_size == 0) {
+        /* would not cover any block of the datagram */
+        DEBUG("6lo rbuf: empty fragment, discarding\n");
+        gnrc_pktbuf_release(pkt);
+        return RBUF_ADD_ERROR;
+    }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD
+    if (offset > 0) {
+        gnrc_sixlowpan_frag_vrb_t *vrbe = gnrc_sixlowpan_frag_vrb_get(
+                gnrc_netif_hdr_get_src_addr(netif_hdr),
+                netif_hdr->src_l2addr_len, datagram_tag
+            );
+
+        if (vrbe != NULL) {
+            /* `pkt` released in _forward_frag() */
+            return _forward_frag(vrbe, pkt, frag_size, offset, page);
+        }
+    }
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD */
+    _rbuf_gc_on_add();
     res = _rbuf_get(gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
                     gnrc_netif_hdr_get_dst_addr(netif_hdr), netif_hdr->dst_l2addr_len,
                     datagram_size, datagram_tag, page);
@@ -254,7 +396,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return RBUF_ADD_ERROR;
     }
 
-    switch (_check_fragments(&entry->super, frag_size, offset)) {
+    switch (_check_rbuf_fragments(entry, frag_size, offset)) {
         case RBUF_ADD_REPEAT:
             DEBUG("6lo rfrag: overlapping intervals, discarding datagram\n");
             gnrc_pktbuf_release(entry->pkt);
@@ -269,6 +411,10 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
 
     if (_rbuf_update_ints(&entry->super, offset, frag_size)) {
         DEBUG("6lo rbuf: add fragment data\n");
+        for (unsigned i = _first_block(offset);
+             i < _end_block(offset, frag_size); i++) {
+            bf_set(entry->received, i);
+        }
         entry->super.current_size += (uint16_t)frag_size;
         if (offset == 0) {
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC
@@ -316,6 +462,43 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     return res;
 }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD
+static int _forward_frag(gnrc_sixlowpan_frag_vrb_t *vrbe, gnrc_pktsnip_t *pkt,
+                         size_t frag_size, size_t offset, unsigned page)
+{
+    if ((offset + frag_size) > vrbe->super.datagram_size) {
+        DEBUG("6lo rbuf: fragment too big for forwarded datagram, "
+              "discarding\n");
+        gnrc_pktbuf_release(pkt);
+        return RBUF_ADD_ERROR;
+    }
+    /* the VRB entry took over the intervals of the reassembly buffer entry of
+     * the first fragment */
+    if (_check_fragments(&vrbe->super, frag_size, offset) != RBUF_ADD_SUCCESS) {
+        DEBUG("6lo rbuf: fragment overlaps already forwarded fragment, "
+              "discarding\n");
+        gnrc_pktbuf_release(pkt);
+        return RBUF_ADD_ERROR;
+    }
+    if (!_rbuf_update_ints(&vrbe->super, offset, frag_size)) {
+        gnrc_pktbuf_release(pkt);
+        return RBUF_ADD_ERROR;
+    }
+    vrbe->super.current_size += frag_size;
+    vrbe->super.arrival = xtimer_now_usec();
+    if (gnrc_sixlowpan_frag_minfwd_forward(pkt, vrbe, page) < 0) {
+        /* the next hop will not be able to reassemble the datagram anyway */
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+        return RBUF_ADD_ERROR;
+    }
+    if (vrbe->super.current_size >= vrbe->super.datagram_size) {
+        DEBUG("6lo rbuf: datagram forwarded completely\n");
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+    }
+    return RBUF_ADD_FORWARDED;
+}
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD */
+
 static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
                                                uint16_t start, uint16_t end)
 {
@@ -377,16 +560,18 @@ static void _gc_pkt(gnrc_sixlowpan_frag_rb_t *rbuf)
     gnrc_pktbuf_release(rbuf->pkt);
 }
 
-void gnrc_sixlowpan_frag_rb_gc(void)
+static void _rbuf_gc(uint32_t now_usec)
 {
-    uint32_t now_usec = xtimer_now_usec();
     unsigned int i;
 
+    _rbuf_gc_pending = false;
     for (i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        if (gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
+            continue;
+        }
         /* since pkt occupies pktbuf, aggressivly collect garbage */
-        if (!gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i]) &&
-              ((now_usec - rbuf[i].super.arrival) >
-               CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
+        if ((now_usec - rbuf[i].super.arrival) >
+            CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US) {
             DEBUG("6lo rfrag: entry (%s, ",
                   gnrc_netif_addr_to_str(rbuf[i].super.src,
                                          rbuf[i].super.src_len,
@@ -400,6 +585,31 @@ void gnrc_sixlowpan_frag_rb_gc(void)
             _gc_pkt(&rbuf[i]);
             gnrc_sixlowpan_frag_rb_remove(&(rbuf[i]));
         }
+        else {
+            _rbuf_gc_note_arrival(rbuf[i].super.arrival);
+        }
+    }
+}
+
+void gnrc_sixlowpan_frag_rb_gc(void)
+{
+    _rbuf_gc(xtimer_now_usec());
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    gnrc_sixlowpan_frag_vrb_gc();
+#endif
+}
+
+static void _rbuf_gc_on_add(void)
+{
+    uint32_t now_usec = xtimer_now_usec();
+
+    /* only check the entries when at least one of them might have timed out.
+     * Entries aged from outside are still collected by the periodic
+     * gnrc_sixlowpan_frag_rb_gc() */
+    if (_rbuf_gc_pending &&
+        ((now_usec - _rbuf_gc_arrival) >
+         CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
+        _rbuf_gc(now_usec);
     }
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     gnrc_sixlowpan_frag_vrb_gc();
@@ -419,46 +629,48 @@ static int _rbuf_get(const void *src, size_t src_len,
 {
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
-
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.datagram_size == size) &&
-            (rbuf[i].super.tag == tag) && (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+    unsigned home = _rbuf_home(src, src_len, dst, dst_len, tag);
+    unsigned idx;
+
+    /* check first if entry already available */
+    res = _rbuf_lookup(home, src, src_len, dst, dst_len, size, tag);
+    if (res != NULL) {
+        DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+              gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) found\n",
+              gnrc_netif_addr_to_str(res->super.dst, res->super.dst_len,
+                                     l2addr_str),
+              (unsigned)res->super.datagram_size, res->super.tag);
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
+        if (res->super.current_size == 0) {
+            /* ensure that only empty reassembly buffer entries and entries
+             * scheduled for deletion have `current_size == 0` */
+            DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+            return -1;
         }
+#endif
+        res->super.arrival = now_usec;
+        _set_rbuf_timeout();
+        return res - &(rbuf[0]);
+    }
+
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        gnrc_sixlowpan_frag_rb_t *e;
 
-        /* if there is a free spot: remember it */
-        if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
-            res = &(rbuf[i]);
+        idx = (home + i) % CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE;
+        e = &rbuf[idx];
+        /* take the first free spot from the home slot on */
+        if (gnrc_sixlowpan_frag_rb_entry_empty(e)) {
+            res = e;
+            break;
         }
 
         /* remember oldest slot */
         /* note that xtimer_now will overflow in ~1.2 hours */
         if ((oldest == NULL) ||
-            (oldest->super.arrival - rbuf[i].super.arrival < UINT32_MAX / 2)) {
-            oldest = &(rbuf[i]);
+            (oldest->super.arrival - e->super.arrival < UINT32_MAX / 2)) {
+            oldest = e;
         }
     }
 
@@ -489,6 +701,14 @@ static int _rbuf_get(const void *src, size_t src_len,
     }
 
     /* now we have an empty spot */
+    idx = res - &(rbuf[0]);
+    _rbuf_homes[idx] = home;
+    /* make sure lookups reach the spot from the home slot */
+    unsigned probes = (idx + CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE - home) %
+                      CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE;
+    if (probes > _rbuf_probes[home]) {
+        _rbuf_probes[home] = probes;
+    }
 
     gnrc_nettype_t reass_type;
     switch (page) {
@@ -519,6 +739,7 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->super.dst_len = dst_len;
     res->super.tag = tag;
     res->super.current_size = 0;
+    _rbuf_gc_note_arrival(now_usec);
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -538,6 +759,9 @@ void gnrc_sixlowpan_frag_rb_reset(void)
 {
     xtimer_remove(&_gc_timer);
     memset(rbuf_int, 0, sizeof(rbuf_int));
+    memset(_rbuf_probes, 0, sizeof(_rbuf_probes));
+    memset(_rbuf_homes, 0, sizeof(_rbuf_homes));
+    _rbuf_gc_pending = false;
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
@@ -577,6 +801,7 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
         rbuf->super.arrival = xtimer_now_usec() -
                               (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US -
                                CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER);
+        _rbuf_gc_note_arrival(rbuf->super.arrival);
         /* reset current size to prevent late duplicates to trigger another
          * dispatch */
         rbuf->super.current_size = 0;
@@ -16,8 +16,11 @@
  * @author      Johann Fischer <j.fischer@phytec.de> (nhc udp encoding)
  */
 
+#include <errno.h>
 #include <stdbool.h>
+#include <string.h>
 
+#include "architecture.h"
 #include "byteorder.h"
 #include "net/ipv6/hdr.h"
 #include "net/ipv6/ext.h"
@@ -26,6 +29,9 @@
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #include "net/gnrc/sixlowpan/frag/rb.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD
+#include "net/gnrc/sixlowpan/frag/minfwd.h"
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD */
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
 #include "net/gnrc/sixlowpan/frag/vrb.h"
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
@@ -147,6 +153,85 @@ static int _forward_frag(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *frag_hdr,
                          gnrc_sixlowpan_frag_vrb_t *vrbe, unsigned page);
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
 
+/**
+ * @brief   Determines the length of an IPHC header from its dispatch bytes
+ *
+ * @param[in] iphc_hdr  The IPHC header. At least @ref SIXLOWPAN_IPHC_HDR_LEN
+ *                      bytes long.
+ *
+ * @return  Length of the IPHC header including its inline fields.
+ */
+static size_t _iphc_hdr_len(const uint8_t *iphc_hdr)
+{
+    size_t len = SIXLOWPAN_IPHC_HDR_LEN;
+
+    if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_CID_EXT) {
+        len++;
+    }
+    switch (iphc_hdr[IPHC1_IDX] & SIXLOWPAN_IPHC1_TF) {
+        case IPHC_TF_ECN_DSCP_FL:
+            len += 4;
+            break;
+        case IPHC_TF_ECN_FL:
+            len += 3;
+            break;
+        case IPHC_TF_ECN_DSCP:
+            len += 1;
+            break;
+        default:
+            break;
+    }
+    if (!(iphc_hdr[IPHC1_IDX] & SIXLOWPAN_IPHC1_NH)) {
+        len++;
+    }
+    if ((iphc_hdr[IPHC1_IDX] & SIXLOWPAN_IPHC1_HL) == IPHC_HL_INLINE) {
+        len++;
+    }
+    switch (iphc_hdr[IPHC2_IDX] & (SIXLOWPAN_IPHC2_SAC | SIXLOWPAN_IPHC2_SAM)) {
+        case IPHC_SAC_SAM_FULL:
+            len += 16;
+            break;
+        case IPHC_SAC_SAM_64:
+        case IPHC_SAC_SAM_CTX_64:
+            len += 8;
+            break;
+        case IPHC_SAC_SAM_16:
+        case IPHC_SAC_SAM_CTX_16:
+            len += 2;
+            break;
+        default:
+            break;
+    }
+    switch (iphc_hdr[IPHC2_IDX] & (SIXLOWPAN_IPHC2_M | SIXLOWPAN_IPHC2_DAC |
+                                   SIXLOWPAN_IPHC2_DAM)) {
+        case IPHC_M_DAC_DAM_U_FULL:
+        case IPHC_M_DAC_DAM_M_FULL:
+            len += 16;
+            break;
+        case IPHC_M_DAC_DAM_U_64:
+        case IPHC_M_DAC_DAM_U_CTX_64:
+            len += 8;
+            break;
+        case IPHC_M_DAC_DAM_U_16:
+        case IPHC_M_DAC_DAM_U_CTX_16:
+            len += 2;
+            break;
+        case IPHC_M_DAC_DAM_M_48:
+        case IPHC_M_DAC_DAM_M_UC_PREFIX:
+            len += 6;
+            break;
+        case IPHC_M_DAC_DAM_M_32:
+            len += 4;
+            break;
+        case IPHC_M_DAC_DAM_M_8:
+            len += 1;
+            break;
+        default:
+            break;
+    }
+    return len;
+}
+
 static size_t _iphc_ipv6_decode(const uint8_t *iphc_hdr,
                                 const gnrc_netif_hdr_t *netif_hdr,
                                 gnrc_netif_t *iface, ipv6_hdr_t *ipv6_hdr)
@@ -433,31 +518,86 @@ static size_t _iphc_ipv6_decode(const uint8_t *iphc_hdr,
     return payload_offset;
 }
 
+/**
+ * @brief   Buffer the uncompressed headers are decoded to
+ */
+typedef struct {
+    gnrc_pktsnip_t *pkt;    /**< snip holding the buffer, NULL while decoding
+                             *   an unfragmented datagram on the stack */
+    uint8_t *data;          /**< the buffer */
+    size_t size;            /**< size of the buffer */
+} _iphc_hdrs_t;
+
+/**
+ * @brief   Makes sure the buffer for the uncompressed headers can hold @p size
+ *          bytes
+ *
+ * If the stack buffer is too small, the headers decoded so far are moved to a
+ * newly allocated snip.
+ *
+ * @param[in,out] hdrs      The buffer for the uncompressed headers.
+ * @param[in] used          Number of bytes already decoded into @p hdrs.
+ * @param[in] size          The required size.
+ *
+ * @return  true, if @p hdrs can hold @p size bytes.
+ * @return  false, if there is not enough space in the packet buffer.
+ */
+static bool _hdrs_reserve(_iphc_hdrs_t *hdrs, size_t used, size_t size)
+{
+    if (size <= hdrs->size) {
+        return true;
+    }
+    if (hdrs->pkt == NULL) {
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, size,
+                                              GNRC_NETTYPE_IPV6);
+
+        if (pkt == NULL) {
+            return false;
+        }
+        memcpy(pkt->data, hdrs->data, used);
+        hdrs->pkt = pkt;
+    }
+    else if (gnrc_pktbuf_realloc_data(hdrs->pkt, size) != 0) {
+        return false;
+    }
+    hdrs->data = hdrs->pkt->data;
+    hdrs->size = hdrs->pkt->size;
+    return true;
+}
+
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
 static size_t _iphc_nhc_ipv6_ext_decode(gnrc_pktsnip_t *sixlo, size_t offset,
                                         size_t *prev_nh_offset,
-                                        gnrc_pktsnip_t *ipv6,
+                                        _iphc_hdrs_t *hdrs,
                                         size_t *uncomp_hdr_len)
 {
     uint8_t *payload = sixlo->data;
+    uint8_t *ipv6;
     ipv6_ext_t *ext_hdr;
     uint8_t ipv6_ext_nhc = payload[offset++];
     uint8_t protnum;
-    uint8_t ext_len = (ipv6_ext_nhc & NHC_IPV6_EXT_NH)
-                    ? payload[offset]
-                    : payload[offset + 1];
-
-    /* realloc size for uncompressed snip, if too small */
-    if (ipv6->size < (*uncomp_hdr_len + sizeof(ipv6_ext_t) + ext_len)) {
-        if (gnrc_pktbuf_realloc_data(ipv6,
-                                     *uncomp_hdr_len + sizeof(ipv6_ext_t) +
-                                     ext_len)) {
-            DEBUG("6lo iphc: unable to decode IPv6 Extension header NHC "
-                  "(not enough buffer space)\n");
-            return 0;
-        }
+    /* length field and, if not compressed, next header field */
+    size_t inline_len = (ipv6_ext_nhc & NHC_IPV6_EXT_NH) ? 1U : 2U;
+
+    if ((offset + inline_len) > sixlo->size) {
+        DEBUG("6lo iphc: IPv6 Extension header NHC exceeds datagram\n");
+        return 0;
     }
-    ext_hdr = (ipv6_ext_t *)((uint8_t *)ipv6->data + *uncomp_hdr_len);
+
+    uint8_t ext_len = payload[offset + inline_len - 1];
+
+    if ((offset + inline_len + ext_len) > sixlo->size) {
+        DEBUG("6lo iphc: IPv6 Extension header NHC exceeds datagram\n");
+        return 0;
+    }
+    if (!_hdrs_reserve(hdrs, *uncomp_hdr_len,
+                       *uncomp_hdr_len + sizeof(ipv6_ext_t) + ext_len)) {
+        DEBUG("6lo iphc: unable to decode IPv6 Extension header NHC "
+              "(not enough buffer space)\n");
+        return 0;
+    }
+    ipv6 = hdrs->data;
+    ext_hdr = (ipv6_ext_t *)(ipv6 + *uncomp_hdr_len);
     switch (ipv6_ext_nhc & NHC_IPV6_EXT_EID_MASK) {
         case NHC_IPV6_EXT_EID_HOPOPT:
             protnum = PROTNUM_IPV6_EXT_HOPOPT;
@@ -479,14 +619,14 @@ static size_t _iphc_nhc_ipv6_ext_decode(gnrc_pktsnip_t *sixlo, size_t offset,
                   (ipv6_ext_nhc & NHC_IPV6_EXT_EID_MASK) >> 1U);
             return 0;
     }
-    ((uint8_t *)ipv6->data)[*prev_nh_offset] = protnum;
+    ipv6[*prev_nh_offset] = protnum;
     if (!(ipv6_ext_nhc & NHC_IPV6_EXT_NH)) {
         ext_hdr->nh = payload[offset++];
         /* signal end of next header compression to caller */
         *prev_nh_offset = 0;
     }
     else {
-        *prev_nh_offset = (&ext_hdr->nh) - ((uint8_t *)ipv6->data);
+        *prev_nh_offset = (&ext_hdr->nh) - ipv6;
     }
     /* skip already fetched length field */
     offset++;
@@ -501,7 +641,7 @@ static size_t _iphc_nhc_ipv6_ext_decode(gnrc_pktsnip_t *sixlo, size_t offset,
 static size_t _iphc_nhc_ipv6_decode(gnrc_pktsnip_t *sixlo, size_t offset,
                                     const gnrc_sixlowpan_frag_rb_t *rbuf,
                                     size_t *prev_nh_offset,
-                                    gnrc_pktsnip_t *ipv6,
+                                    _iphc_hdrs_t *hdrs,
                                     size_t *uncomp_hdr_len)
 {
     uint8_t *payload = sixlo->data;
@@ -515,7 +655,7 @@ static size_t _iphc_nhc_ipv6_decode(gnrc_pktsnip_t *sixlo, size_t offset,
         case NHC_IPV6_EXT_EID_MOB: {
             size_t tmp;
             tmp = _iphc_nhc_ipv6_ext_decode(sixlo, offset, prev_nh_offset,
-                                            ipv6, uncomp_hdr_len);
+                                            hdrs, uncomp_hdr_len);
             if (tmp == 0) {
                 /* unable to parse IPHC header */
                 return 0;
@@ -527,21 +667,25 @@ static size_t _iphc_nhc_ipv6_decode(gnrc_pktsnip_t *sixlo, size_t offset,
             gnrc_pktsnip_t *netif = gnrc_pktsnip_search_type(sixlo,
                                                              GNRC_NETTYPE_NETIF);
             ipv6_hdr_t *ipv6_hdr;
+            uint8_t *ipv6;
             uint16_t payload_len;
             size_t tmp;
 
             offset++;   /* move over NHC header */
-            /* realloc size for uncompressed snip, if too small */
-            if (ipv6->size < (*uncomp_hdr_len + sizeof(ipv6_hdr_t))) {
-                if (gnrc_pktbuf_realloc_data(ipv6,
-                                             *uncomp_hdr_len +
-                                             sizeof(ipv6_hdr_t))) {
-                    DEBUG("6lo iphc: unable to decode IPv6 encapsulated header "
-                          "NHC (not enough buffer space)\n");
-                    return 0;
-                }
+            if (((offset + SIXLOWPAN_IPHC_HDR_LEN) > sixlo->size) ||
+                ((offset + _iphc_hdr_len(&payload[offset])) > sixlo->size)) {
+                DEBUG("6lo iphc: IPv6 encapsulated header NHC exceeds "
+                      "datagram\n");
+                return 0;
             }
-            ipv6_hdr = (ipv6_hdr_t *)(((uint8_t *)ipv6->data) + *uncomp_hdr_len);
+            if (!_hdrs_reserve(hdrs, *uncomp_hdr_len,
+                               *uncomp_hdr_len + sizeof(ipv6_hdr_t))) {
+                DEBUG("6lo iphc: unable to decode IPv6 encapsulated header "
+                      "NHC (not enough buffer space)\n");
+                return 0;
+            }
+            ipv6 = hdrs->data;
+            ipv6_hdr = (ipv6_hdr_t *)(ipv6 + *uncomp_hdr_len);
             tmp = _iphc_ipv6_decode(&payload[offset], netif->data,
                                     gnrc_netif_hdr_get_netif(netif->data),
                                     ipv6_hdr);
@@ -549,9 +693,9 @@ static size_t _iphc_nhc_ipv6_decode(gnrc_pktsnip_t *sixlo, size_t offset,
                 /* unable to parse IPHC header */
                 return 0;
             }
-            ((uint8_t *)ipv6->data)[*prev_nh_offset] = PROTNUM_IPV6;
+            ipv6[*prev_nh_offset] = PROTNUM_IPV6;
             if (payload[offset + IPHC1_IDX] & SIXLOWPAN_IPHC1_NH) {
-                *prev_nh_offset = (&ipv6_hdr->nh) - ((uint8_t *)ipv6->data);
+                *prev_nh_offset = (&ipv6_hdr->nh) - ipv6;
             }
             else {
                 /* signal end of next header compression to caller */
@@ -587,10 +731,9 @@ static size_t _iphc_nhc_ipv6_decode(gnrc_pktsnip_t *sixlo, size_t offset,
  * @param[in] rbuf                  Reassembly buffer entry if @p ipv6 is a
  *                                  fragmented datagram. May be NULL, if @p ipv6
  *                                  is not fragmented
- * @param[out] prev_nh_offset       Offset to previous nh field in
- *                                  gnrc_pktsnip_t::data of @p ipv6
- * @param[out] ipv6                 The packet to write the decoded data to
- * @param[in,out] uncomp_hdr_len    Number of bytes already decoded into @p ipv6
+ * @param[out] prev_nh_offset       Offset to previous nh field in @p hdrs
+ * @param[in,out] hdrs              The buffer to write the decoded headers to
+ * @param[in,out] uncomp_hdr_len    Number of bytes already decoded into @p hdrs
  *                                  by IPHC and other NHC. Adds size of @ref
  *                                  udp_hdr_t after successful UDP header
  *                                  decompression
@@ -600,24 +743,43 @@ static size_t _iphc_nhc_ipv6_decode(gnrc_pktsnip_t *sixlo, size_t offset,
  */
 static size_t _iphc_nhc_udp_decode(gnrc_pktsnip_t *sixlo, size_t offset,
                                    const gnrc_sixlowpan_frag_rb_t *rbuf,
-                                   size_t prev_nh_offset, gnrc_pktsnip_t *ipv6,
+                                   size_t prev_nh_offset, _iphc_hdrs_t *hdrs,
                                    size_t *uncomp_hdr_len)
 {
     uint8_t *payload = sixlo->data;
+    uint8_t *ipv6;
     udp_hdr_t *udp_hdr;
     uint16_t payload_len;
     uint8_t udp_nhc = payload[offset++];
     uint8_t tmp;
+    /* inline ports and checksum */
+    size_t inline_len = sizeof(udp_hdr->checksum);
 
-    /* realloc size for uncompressed snip, if too small */
-    if (ipv6->size < (*uncomp_hdr_len + sizeof(udp_hdr_t))) {
-        if (gnrc_pktbuf_realloc_data(ipv6,
-                                     *uncomp_hdr_len + sizeof(udp_hdr_t))) {
-            DEBUG("6lo: unable to decode UDP NHC (not enough buffer space)\n");
-            return 0;
-        }
+    switch (udp_nhc & NHC_UDP_PP_MASK) {
+        case NHC_UDP_SD_INLINE:
+            inline_len += 4U;
+            break;
+        case NHC_UDP_S_INLINE:
+        case NHC_UDP_D_INLINE:
+            inline_len += 3U;
+            break;
+        case NHC_UDP_SD_ELIDED:
+            inline_len += 1U;
+            break;
+        default:
+            break;
+    }
+    if ((offset + inline_len) > sixlo->size) {
+        DEBUG("6lo: UDP NHC exceeds datagram\n");
+        return 0;
+    }
+    if (!_hdrs_reserve(hdrs, *uncomp_hdr_len,
+                       *uncomp_hdr_len + sizeof(udp_hdr_t))) {
+        DEBUG("6lo: unable to decode UDP NHC (not enough buffer space)\n");
+        return 0;
     }
-    udp_hdr = (udp_hdr_t *)((uint8_t *)ipv6->data + *uncomp_hdr_len);
+    ipv6 = hdrs->data;
+    udp_hdr = (udp_hdr_t *)(ipv6 + *uncomp_hdr_len);
     network_uint16_t *src_port = &(udp_hdr->src_port);
     network_uint16_t *dst_port = &(udp_hdr->dst_port);
 
@@ -675,7 +837,7 @@ static size_t _iphc_nhc_udp_decode(gnrc_pktsnip_t *sixlo, size_t offset,
     }
     udp_hdr->length = byteorder_htons(payload_len);
     *uncomp_hdr_len += sizeof(udp_hdr_t);
-    ((uint8_t *)ipv6->data)[prev_nh_offset] = PROTNUM_UDP;
+    ipv6[prev_nh_offset] = PROTNUM_UDP;
 
     return offset;
 }
@@ -691,14 +853,60 @@ static inline void _recv_error_release(gnrc_pktsnip_t *sixlo,
     gnrc_pktbuf_release(sixlo);
 }
 
+/**
+ * @brief   Replaces the compressed headers in an unfragmented datagram by their
+ *          decoded form
+ *
+ * Only the payload after the compressed headers is moved, so at most one
+ * reallocation is needed and no new snip is allocated for the IPv6 header.
+ *
+ * @param[in,out] sixlo         The IPHC encoded datagram. Becomes the IPv6
+ *                              snip on success.
+ * @param[in] hdrs              The decoded headers.
+ * @param[in] uncomp_hdr_len    Length of @p hdrs.
+ * @param[in] payload_offset    The offset of the payload in @p sixlo (i.e. the
+ *                              length of the compressed headers).
+ *
+ * @return  0 on success.
+ * @return  -ENOMEM if @p sixlo could not be enlarged.
+ */
+static int _decode_in_place(gnrc_pktsnip_t *sixlo, const uint8_t *hdrs,
+                            size_t uncomp_hdr_len, size_t payload_offset)
+{
+    size_t payload_size = sixlo->size - payload_offset;
+
+    if (uncomp_hdr_len > payload_offset) {
+        if (gnrc_pktbuf_realloc_data(sixlo,
+                                     uncomp_hdr_len + payload_size) != 0) {
+            return -ENOMEM;
+        }
+        memmove(((uint8_t *)sixlo->data) + uncomp_hdr_len,
+                ((uint8_t *)sixlo->data) + payload_offset, payload_size);
+    }
+    else {
+        memmove(((uint8_t *)sixlo->data) + uncomp_hdr_len,
+                ((uint8_t *)sixlo->data) + payload_offset, payload_size);
+        /* shrinking can't fail */
+        gnrc_pktbuf_realloc_data(sixlo, uncomp_hdr_len + payload_size);
+    }
+    memcpy(sixlo->data, hdrs, uncomp_hdr_len);
+    sixlo->type = GNRC_NETTYPE_IPV6;
+    return 0;
+}
+
 void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
                               unsigned page)
 {
     assert(sixlo != NULL);
-    gnrc_pktsnip_t *ipv6, *netif;
+    gnrc_pktsnip_t *ipv6 = NULL, *netif;
     gnrc_netif_t *iface;
     ipv6_hdr_t *ipv6_hdr;
     uint8_t *iphc_hdr = sixlo->data;
+    /* headers of an unfragmented datagram are decoded here first and then
+     * copied in place of the compressed headers */
+    uint8_t hdrs_buf[CONFIG_GNRC_SIXLOWPAN_IPHC_HDRS_BUF_SIZE] WORD_ALIGNED;
+    _iphc_hdrs_t hdrs = { .pkt = NULL, .data = hdrs_buf,
+                          .size = sizeof(hdrs_buf) };
     size_t payload_offset;
     size_t uncomp_hdr_len = sizeof(ipv6_hdr_t);
     gnrc_sixlowpan_frag_rb_t *rbuf = rbuf_ptr;
@@ -707,37 +915,42 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
 
     if (rbuf != NULL) {
-        ipv6 = rbuf->pkt;
-        assert(ipv6 != NULL);
-    }
-    else {
-        ipv6 = gnrc_pktbuf_add(NULL, NULL, sizeof(ipv6_hdr_t),
-                               GNRC_NETTYPE_IPV6);
-        if (ipv6 == NULL) {
-            gnrc_pktbuf_release(sixlo);
-            return;
-        }
+        hdrs.pkt = rbuf->pkt;
+        assert(hdrs.pkt != NULL);
+        hdrs.data = hdrs.pkt->data;
+        hdrs.size = hdrs.pkt->size;
     }
 
-    assert(ipv6->size >= sizeof(ipv6_hdr_t));
+    assert(hdrs.size >= sizeof(ipv6_hdr_t));
 
     netif = gnrc_pktsnip_search_type(sixlo, GNRC_NETTYPE_NETIF);
     assert(netif != NULL);
     iface = gnrc_netif_hdr_get_netif(netif->data);
+    if ((sixlo->size < SIXLOWPAN_IPHC_HDR_LEN) ||
+        (sixlo->size < _iphc_hdr_len(iphc_hdr))) {
+        DEBUG("6lo iphc: IPHC header exceeds datagram\n");
+        _recv_error_release(sixlo, hdrs.pkt, rbuf);
+        return;
+    }
     payload_offset = _iphc_ipv6_decode(iphc_hdr, netif->data, iface,
-                                       ipv6->data);
+                                       (ipv6_hdr_t *)hdrs.data);
     if (payload_offset == 0) {
         /* unable to parse IPHC header */
-        _recv_error_release(sixlo, ipv6, rbuf);
+        _recv_error_release(sixlo, hdrs.pkt, rbuf);
         return;
     }
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
     if (iphc_hdr[IPHC1_IDX] & SIXLOWPAN_IPHC1_NH) {
         bool nhc_header = true;
-        ipv6_hdr = ipv6->data;
-        size_t prev_nh_offset = (&ipv6_hdr->nh) - ((uint8_t *)ipv6->data);
+        ipv6_hdr = (ipv6_hdr_t *)hdrs.data;
+        size_t prev_nh_offset = (&ipv6_hdr->nh) - hdrs.data;
 
         while (nhc_header) {
+            if (payload_offset >= sixlo->size) {
+                DEBUG("6lo iphc: NHC header exceeds datagram\n");
+                _recv_error_release(sixlo, hdrs.pkt, rbuf);
+                return;
+            }
             switch (iphc_hdr[payload_offset] & NHC_ID_MASK) {
                 case NHC_IPV6_EXT_ID:
                 case NHC_IPV6_EXT_ID_ALT:
@@ -745,10 +958,10 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
                                                            payload_offset,
                                                            rbuf,
                                                            &prev_nh_offset,
-                                                           ipv6,
+                                                           &hdrs,
                                                            &uncomp_hdr_len);
                     if (payload_offset == 0) {
-                        _recv_error_release(sixlo, ipv6, rbuf);
+                        _recv_error_release(sixlo, hdrs.pkt, rbuf);
                         return;
                     }
                     /* prev_nh_offset is set to 0 if next header is not
@@ -760,10 +973,10 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
                                                           payload_offset,
                                                           rbuf,
                                                           prev_nh_offset,
-                                                          ipv6,
+                                                          &hdrs,
                                                           &uncomp_hdr_len);
                     if (payload_offset == 0) {
-                        _recv_error_release(sixlo, ipv6, rbuf);
+                        _recv_error_release(sixlo, hdrs.pkt, rbuf);
                         return;
                     }
                     /* no NHC after UDP header */
@@ -777,6 +990,7 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
         }
     }
 #endif
+    ipv6 = hdrs.pkt;
     uint16_t payload_len;
     if (rbuf != NULL) {
         /* for a fragmented datagram we know the overall length already */
@@ -821,12 +1035,26 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
          * after removing the 6LoWPAN header and adding uncompressed headers */
         payload_len = (sixlo->size + uncomp_hdr_len -
                        payload_offset - sizeof(ipv6_hdr_t));
-    }
-    if ((rbuf == NULL) &&
-        (gnrc_pktbuf_realloc_data(ipv6, uncomp_hdr_len + payload_len) != 0)) {
-        DEBUG("6lo iphc: no space left to copy payload\n");
-        _recv_error_release(sixlo, ipv6, rbuf);
-        return;
+        if (ipv6 == NULL) {
+            ipv6_hdr = (ipv6_hdr_t *)hdrs.data;
+            ipv6_hdr->len = byteorder_htons(payload_len);
+            if (_decode_in_place(sixlo, hdrs.data, uncomp_hdr_len,
+                                 payload_offset) != 0) {
+                DEBUG("6lo iphc: no space left to decode headers\n");
+                gnrc_pktbuf_release(sixlo);
+                return;
+            }
+            gnrc_sixlowpan_dispatch_recv(sixlo, NULL, page);
+            return;
+        }
+        /* headers did not fit into the stack buffer, copy the payload behind
+         * them instead */
+        if (gnrc_pktbuf_realloc_data(ipv6, uncomp_hdr_len + sixlo->size -
+                                     payload_offset) != 0) {
+            DEBUG("6lo iphc: no space left to copy payload\n");
+            _recv_error_release(sixlo, ipv6, rbuf);
+            return;
+        }
     }
     /* re-assign IPv6 header in case realloc changed the address */
     ipv6_hdr = ipv6->data;
@@ -834,38 +1062,38 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
     memcpy(((uint8_t *)ipv6->data) + uncomp_hdr_len,
            ((uint8_t *)sixlo->data) + payload_offset,
            sixlo->size - payload_offset);
-    if (rbuf != NULL) {
-        rbuf->super.current_size += (uncomp_hdr_len - payload_offset);
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
-        if (vrbe != NULL) {
-            int res = -1;
-            DEBUG("6lo iphc: found route, trying to forward\n");
-            ipv6_hdr->hl--;
-            vrbe->super.current_size = rbuf->super.current_size;
-            if ((ipv6 = _encode_frag_for_forwarding(ipv6, vrbe))) {
-                if ((res = _forward_frag(ipv6, sixlo->next, vrbe, page)) == 0) {
-                    DEBUG("6lo iphc: successfully recompressed and forwarded "
-                          "1st fragment\n");
-                    /* empty list, as it should be in VRB now */
-                    rbuf->super.ints = NULL;
-                }
-            }
-            if ((ipv6 == NULL) || (res < 0)) {
-                gnrc_sixlowpan_frag_vrb_rm(vrbe);
-            }
-            gnrc_pktbuf_release(sixlo);
-            /* don't remove `rbuf->pkt` (aka ipv6) as it was forwarded */
-            gnrc_sixlowpan_frag_rb_remove(rbuf);
-            return;
-        }
-        DEBUG("6lo iphc: no route found, reassemble datagram normally\n");
-#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
-    }
-    else {
+    if (rbuf == NULL) {
         sixlo = gnrc_pkt_delete(sixlo, netif);
         ipv6 = gnrc_pkt_append(ipv6, netif);
         gnrc_sixlowpan_dispatch_recv(ipv6, NULL, page);
+        gnrc_pktbuf_release(sixlo);
+        return;
     }
+    rbuf->super.current_size += (uncomp_hdr_len - payload_offset);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    if (vrbe != NULL) {
+        int res = -1;
+        DEBUG("6lo iphc: found route, trying to forward\n");
+        ipv6_hdr->hl--;
+        vrbe->super.current_size = rbuf->super.current_size;
+        if ((ipv6 = _encode_frag_for_forwarding(ipv6, vrbe))) {
+            if ((res = _forward_frag(ipv6, sixlo->next, vrbe, page)) == 0) {
+                DEBUG("6lo iphc: successfully recompressed and forwarded "
+                      "1st fragment\n");
+                /* empty list, as it should be in VRB now */
+                rbuf->super.ints = NULL;
+            }
+        }
+        if ((ipv6 == NULL) || (res < 0)) {
+            gnrc_sixlowpan_frag_vrb_rm(vrbe);
+        }
+        gnrc_pktbuf_release(sixlo);
+        /* don't remove `rbuf->pkt` (aka ipv6) as it was forwarded */
+        gnrc_sixlowpan_frag_rb_remove(rbuf);
+        return;
+    }
+    DEBUG("6lo iphc: no route found, reassemble datagram normally\n");
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
     gnrc_pktbuf_release(sixlo);
     return;
 }
@@ -912,6 +1140,10 @@ static gnrc_pktsnip_t *_encode_frag_for_forwarding(gnrc_pktsnip_t *decoded_pkt,
 static int _forward_frag(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *frag_hdr,
                          gnrc_sixlowpan_frag_vrb_t *vrbe, unsigned page)
 {
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD
+    (void)frag_hdr;
+    return gnrc_sixlowpan_frag_minfwd_frag_iphc(pkt, vrbe, page);
+#else   /* MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD */
     /* remove rewritten netif header (forwarding implementation must do this
      * anyway) */
     pkt = gnrc_pktbuf_remove_snip(pkt, pkt);
@@ -937,6 +1169,7 @@ static int _forward_frag(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *frag_hdr,
     (void)frag_hdr;
     (void)page;
     return -ENOTSUP;
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD */
 }
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
 
@@ -13,6 +13,8 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <assert.h>
+
 #include "net/gnrc/pktbuf.h"
 
 gnrc_pktsnip_t *gnrc_pktbuf_remove_snip(gnrc_pktsnip_t *pkt,
@@ -25,6 +27,18 @@ gnrc_pktsnip_t *gnrc_pktbuf_remove_snip(gnrc_pktsnip_t *pkt,
     return pkt;
 }
 
+gnrc_pktsnip_t *gnrc_pktbuf_commit(gnrc_pktsnip_t *pkt, size_t size,
+                                   size_t hdr_size, gnrc_nettype_t type)
+{
+    assert(size <= pkt->size);
+    if (size <= hdr_size) {
+        return NULL;
+    }
+    /* shrinking is always done in place */
+    gnrc_pktbuf_realloc_data(pkt, size);
+    return gnrc_pktbuf_mark(pkt, hdr_size, type);
+}
+
 gnrc_pktsnip_t *gnrc_pktbuf_reverse_snips(gnrc_pktsnip_t *pkt)
 {
     gnrc_pktsnip_t *reversed = NULL, *ptr = pkt;
@@ -112,6 +112,13 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
     return pkt;
 }
 
+gnrc_pktsnip_t *gnrc_pktbuf_loan(size_t size, size_t hdr_size)
+{
+    /* _mark() has to move the payload anyway, so no placement is needed */
+    (void)hdr_size;
+    return gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+}
+
 static gnrc_pktsnip_t *_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *header;
@@ -0,0 +1,475 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer implementation using fixed size blocks
+ *
+ * Packet snip descriptors and their data are allocated from separate pools of
+ * fixed size blocks (slabs), data from the smallest size class it fits into.
+ * Free blocks are kept in a singly linked list per slab, so allocation and
+ * release take constant time and no merging of holes is needed.
+ *
+ * gnrc_pktbuf_mark() splits the data of a snip without copying, so a data
+ * block may be referenced by several snips. Each block thus has a reference
+ * count and is only returned to its slab when the last snip referencing it is
+ * released.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* blocks are word aligned and hold at least a pointer for the free list */
+#define _WORDS(size)    (((size) + sizeof(uintptr_t) - 1) / sizeof(uintptr_t))
+#define _BLOCK(size)    (_WORDS(size) * sizeof(uintptr_t))
+
+#define _SNIPS_NUMOF    CONFIG_GNRC_PKTBUF_SLAB_SNIPS_NUMOF
+#define _SMALL_NUMOF    CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define _MEDIUM_NUMOF   CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF
+#define _LARGE_NUMOF    CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF
+
+#if (CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE > CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE) || \
+    (CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE > CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE)
+#error "gnrc_pktbuf_slab: size classes must be ordered by size"
+#endif
+
+typedef struct {
+    uint8_t *pool;          /**< first block of the slab */
+    uint8_t *refs;          /**< number of snips referencing each block */
+    void *free;             /**< first free block */
+    uint16_t size;          /**< size of a block */
+    uint16_t numof;         /**< number of blocks */
+    uint16_t used;          /**< number of used blocks */
+#ifdef DEVELHELP
+    uint16_t max_used;      /**< maximum number of used blocks */
+#endif
+} _slab_t;
+
+enum {
+    _SNIPS = 0,
+    _SMALL,
+    _MEDIUM,
+    _LARGE,
+    _SLABS_NUMOF,
+};
+
+static mutex_t _mutex = MUTEX_INIT;
+
+static uintptr_t _snips_pool[_SNIPS_NUMOF * _WORDS(sizeof(gnrc_pktsnip_t))];
+static uintptr_t _small_pool[_SMALL_NUMOF *
+                             _WORDS(CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE)];
+static uintptr_t _medium_pool[_MEDIUM_NUMOF *
+                              _WORDS(CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE)];
+static uintptr_t _large_pool[_LARGE_NUMOF *
+                             _WORDS(CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE)];
+static uint8_t _snips_refs[_SNIPS_NUMOF];
+static uint8_t _small_refs[_SMALL_NUMOF];
+static uint8_t _medium_refs[_MEDIUM_NUMOF];
+static uint8_t _large_refs[_LARGE_NUMOF];
+
+static _slab_t _slabs[_SLABS_NUMOF] = {
+    [_SNIPS] = {
+        .pool = (uint8_t *)_snips_pool, .refs = _snips_refs,
+        .size = _BLOCK(sizeof(gnrc_pktsnip_t)), .numof = _SNIPS_NUMOF,
+    },
+    [_SMALL] = {
+        .pool = (uint8_t *)_small_pool, .refs = _small_refs,
+        .size = _BLOCK(CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE),
+        .numof = _SMALL_NUMOF,
+    },
+    [_MEDIUM] = {
+        .pool = (uint8_t *)_medium_pool, .refs = _medium_refs,
+        .size = _BLOCK(CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE),
+        .numof = _MEDIUM_NUMOF,
+    },
+    [_LARGE] = {
+        .pool = (uint8_t *)_large_pool, .refs = _large_refs,
+        .size = _BLOCK(CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE),
+        .numof = _LARGE_NUMOF,
+    },
+};
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+static inline bool _slab_contains(const _slab_t *slab, const void *ptr)
+{
+    return (size_t)((const uint8_t *)ptr - slab->pool) <
+           ((size_t)slab->size * slab->numof);
+}
+
+static inline unsigned _slab_block(const _slab_t *slab, const void *ptr)
+{
+    return ((const uint8_t *)ptr - slab->pool) / slab->size;
+}
+
+static _slab_t *_slab_of(const void *ptr)
+{
+    for (unsigned i = 0; i < _SLABS_NUMOF; i++) {
+        if (_slab_contains(&_slabs[i], ptr)) {
+            return &_slabs[i];
+        }
+    }
+    return NULL;
+}
+
+static void *_slab_alloc(_slab_t *slab)
+{
+    void *block = slab->free;
+
+    if (block == NULL) {
+        return NULL;
+    }
+    memcpy(&slab->free, block, sizeof(void *));
+    slab->refs[_slab_block(slab, block)] = 1;
+    slab->used++;
+#ifdef DEVELHELP
+    if (slab->used > slab->max_used) {
+        slab->max_used = slab->used;
+    }
+#endif
+    return block;
+}
+
+static void _slab_push(_slab_t *slab, uint8_t *block)
+{
+    memcpy(block, &slab->free, sizeof(void *));
+    slab->free = block;
+}
+
+/* returns the block containing ptr to its slab, if no other snip references
+ * it anymore */
+static void _pktbuf_free(void *ptr)
+{
+    _slab_t *slab = _slab_of(ptr);
+
+    if (slab == NULL) {
+        return;
+    }
+
+    unsigned block = _slab_block(slab, ptr);
+
+    assert(slab->refs[block] > 0);
+    if (--slab->refs[block] == 0) {
+        _slab_push(slab, slab->pool + (block * slab->size));
+        slab->used--;
+    }
+}
+
+/* allocates from the smallest size class that fits size and has a free block */
+static void *_data_alloc(size_t size)
+{
+    for (unsigned i = _SMALL; i < _SLABS_NUMOF; i++) {
+        if (size <= _slabs[i].size) {
+            void *data = _slab_alloc(&_slabs[i]);
+            if (data != NULL) {
+                return data;
+            }
+        }
+    }
+    DEBUG("pktbuf: no block of size %u left\n", (unsigned)size);
+    return NULL;
+}
+
+/* number of bytes from ptr to the end of its block, if only one snip
+ * references the block */
+static size_t _data_avail(const void *ptr)
+{
+    _slab_t *slab = _slab_of(ptr);
+
+    if (slab == NULL) {
+        return 0;
+    }
+
+    unsigned block = _slab_block(slab, ptr);
+
+    if (slab->refs[block] != 1) {
+        return 0;
+    }
+    return (slab->pool + ((block + 1) * slab->size)) - (const uint8_t *)ptr;
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < _SLABS_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        slab->free = NULL;
+        slab->used = 0;
+        for (unsigned block = slab->numof; block > 0; block--) {
+            _slab_push(slab, slab->pool + ((block - 1) * slab->size));
+        }
+    }
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE) {
+        DEBUG("pktbuf: size (%u) > CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE (%u)\n",
+              (unsigned)size, CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE);
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_loan(size_t size, size_t hdr_size)
+{
+    /* marking shares the data block, so no placement is needed */
+    (void)hdr_size;
+    return gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+
+    mutex_lock(&_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _slab_alloc(&_slabs[_SNIPS]);
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    _set_pktsnip(marked_snip, pkt->next, pkt->data, size, type);
+    if (pkt->size != size) {
+        /* both snips now reference the data's block */
+        _slab_t *slab = _slab_of(pkt->data);
+        if (slab != NULL) {
+            slab->refs[_slab_block(slab, pkt->data)]++;
+        }
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    else {
+        pkt->data = NULL;
+    }
+    pkt->size -= size;
+    pkt->next = marked_snip;
+    mutex_unlock(&_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && _slab_of(pkt->data)));
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        _pktbuf_free(pkt->data);
+        pkt->data = NULL;
+    }
+    /* if new size is bigger than what is left of the block */
+    else if ((size > pkt->size) && (size > _data_avail(pkt->data))) {
+        void *new_data = NULL;
+
+        if (size <= CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE) {
+            new_data = _data_alloc(size);
+        }
+        if (new_data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&_mutex);
+            return ENOMEM;
+        }
+        if (pkt->data != NULL) {            /* if old data exist */
+            memcpy(new_data, pkt->data, pkt->size);
+            _pktbuf_free(pkt->data);
+        }
+        pkt->data = new_data;
+    }
+    pkt->size = size;
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&_mutex);
+}
+
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(_slab_contains(&_slabs[_SNIPS], pkt));
+        assert(pkt->users > 0);
+        tmp = pkt->next;
+        if (pkt->users == 1) {
+            pkt->users = 0; /* not necessary but to be on the safe side */
+            _pktbuf_free(pkt->data);
+            _pktbuf_free(pkt);
+        }
+        else {
+            pkt->users--;
+        }
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        pkt = tmp;
+    }
+}
+
+void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    mutex_lock(&_mutex);
+    _release_error_locked(pkt, err);
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&_mutex);
+        return new;
+    }
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    static const char *names[] = { "snips", "small", "medium", "large" };
+
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < _SLABS_NUMOF; i++) {
+        printf("packet buffer %s: %u of %u blocks of %u bytes used (max: %u)\n",
+               names[i], _slabs[i].used, _slabs[i].numof, _slabs[i].size,
+               _slabs[i].max_used);
+    }
+    mutex_unlock(&_mutex);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < _SLABS_NUMOF; i++) {
+        if (_slabs[i].used) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - forall blocks in a slab's free list: the block is within the slab and
+     *    starts at a block boundary
+     *  - forall slabs: the length of the free list is numof - used
+     */
+    for (unsigned i = 0; i < _SLABS_NUMOF; i++) {
+        const _slab_t *slab = &_slabs[i];
+        unsigned free = 0;
+
+        for (const uint8_t *block = slab->free; block != NULL;
+             memcpy(&block, block, sizeof(void *))) {
+            if (!_slab_contains(slab, block) ||
+                ((block - slab->pool) % slab->size) ||
+                (++free > slab->numof)) {
+                return false;
+            }
+        }
+        if (free != (unsigned)(slab->numof - slab->used)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _slab_alloc(&_slabs[_SNIPS]);
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _data_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            _pktbuf_free(pkt);
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+/** @} */
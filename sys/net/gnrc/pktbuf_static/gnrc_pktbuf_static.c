@@ -70,6 +70,13 @@ static inline size_t _align(size_t size)
     return (size + _ALIGNMENT_MASK) & ~(_ALIGNMENT_MASK);
 }
 
+/* offset of data from the start of its chunk. This is only non-zero for
+ * packets created with gnrc_pktbuf_loan() and the snips split from them */
+static inline size_t _chunk_offset(const void *data)
+{
+    return ((uint8_t *)data - _pktbuf) & _ALIGNMENT_MASK;
+}
+
 static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
                                 void *data, size_t size, gnrc_nettype_t type)
 {
@@ -108,11 +115,31 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
     return pkt;
 }
 
+gnrc_pktsnip_t *gnrc_pktbuf_loan(size_t size, size_t hdr_size)
+{
+    /* place the header so that the data following it starts at a chunk
+     * boundary. This way gnrc_pktbuf_commit() can split it off in place */
+    size_t offset = (size > 0) ? (_align(hdr_size) - hdr_size) : 0;
+    gnrc_pktsnip_t *pkt;
+
+    if ((size + offset) > CONFIG_GNRC_PKTBUF_SIZE) {
+        DEBUG("pktbuf: size (%u) > CONFIG_GNRC_PKTBUF_SIZE (%u)\n",
+              (unsigned)(size + offset), CONFIG_GNRC_PKTBUF_SIZE);
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(NULL, NULL, size + offset, GNRC_NETTYPE_UNDEF);
+    if ((pkt != NULL) && (pkt->data != NULL)) {
+        pkt->data = ((uint8_t *)pkt->data) + offset;
+        pkt->size = size;
+    }
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
 gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *marked_snip;
-    /* size required for chunk */
-    size_t required_new_size = _align(size);
     void *new_data_marked;
 
     mutex_lock(&_mutex);
@@ -131,9 +158,10 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
         mutex_unlock(&_mutex);
         return NULL;
     }
-    /* marked data would not fit _unused_t marker => move data around to allow
-     * for proper free */
-    if ((pkt->size != size) && (size < required_new_size)) {
+    /* remaining data would not start at a chunk boundary => move data around
+     * to allow for proper free */
+    if ((pkt->size != size) &&
+        ((_chunk_offset(pkt->data) + size) & _ALIGNMENT_MASK)) {
         void *new_data_rest;
         new_data_marked = _pktbuf_alloc(size);
         if (new_data_marked == NULL) {
@@ -171,8 +199,6 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
 
 int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 {
-    size_t aligned_size = _align(size);
-
     mutex_lock(&_mutex);
     assert(pkt != NULL);
     assert(((pkt->size == 0) && (pkt->data == NULL)) ||
@@ -203,9 +229,14 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
         _pktbuf_free(pkt->data, pkt->size);
         pkt->data = new_data;
     }
-    else if (_align(pkt->size) > aligned_size) {
-        _pktbuf_free(((uint8_t *)pkt->data) + aligned_size,
-                     pkt->size - aligned_size);
+    else {
+        size_t offset = _chunk_offset(pkt->data);
+        size_t aligned_size = _align(offset + size);
+
+        if (_align(offset + pkt->size) > aligned_size) {
+            _pktbuf_free(((uint8_t *)pkt->data) - offset + aligned_size,
+                         (offset + pkt->size) - aligned_size);
+        }
     }
     pkt->size = size;
     mutex_unlock(&_mutex);
@@ -476,6 +507,10 @@ static void _pktbuf_free(void *data, size_t size)
     if (!_pktbuf_contains(data)) {
         return;
     }
+    /* free the whole chunk, data of a loaned snip may start behind it */
+    size += _chunk_offset(data);
+    data = ((uint8_t *)data) - _chunk_offset(data);
+    new = data;
     while (ptr && (((void *)ptr) < data)) {
         prev = ptr;
         ptr = ptr->next;
@@ -417,6 +417,33 @@ void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb)
     TCP_DEBUG_LEAVE;
 }
 
+int gnrc_tcp_tcb_set_rcv_buf(gnrc_tcp_tcb_t *tcb, void *buf, size_t size)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+    assert(buf != NULL);
+
+    if (size == 0) {
+        TCP_DEBUG_ERROR("-EINVAL: Invalid receive buffer size.");
+        TCP_DEBUG_LEAVE;
+        return -EINVAL;
+    }
+
+    mutex_lock(&(tcb->function_lock));
+    if (tcb->state != FSM_STATE_CLOSED) {
+        mutex_unlock(&(tcb->function_lock));
+        TCP_DEBUG_ERROR("-EISCONN: TCB already connected.");
+        TCP_DEBUG_LEAVE;
+        return -EISCONN;
+    }
+    tcb->rcv_buf_raw = buf;
+    ringbuffer_init(&(tcb->rcv_buf), buf, size);
+    tcb->status |= STATUS_USER_RCV_BUF;
+    mutex_unlock(&(tcb->function_lock));
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
 int gnrc_tcp_open_active(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote, uint16_t local_port)
 {
     TCP_DEBUG_ENTER;
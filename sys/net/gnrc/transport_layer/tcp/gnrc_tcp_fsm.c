@@ -234,7 +234,10 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         return -ENOMEM;
     }
 
-    tcb->rcv_wnd = CONFIG_GNRC_TCP_DEFAULT_WINDOW;
+    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+    tcb->status &= ~(STATUS_WSCALE | STATUS_SACK);
+    tcb->snd_wnd_scale = 0;
+    tcb->rcv_wnd_scale = 0;
 
     if (tcb->status & STATUS_PASSIVE) {
         /* Passive open, T: CLOSED -> LISTEN */
@@ -246,6 +249,16 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         tcb->snd_nxt = tcb->iss;
         tcb->snd_una = tcb->iss;
 
+        /* Offer window scaling if the receive buffer exceeds the window field
+         * and SACK if segments received out of order are kept */
+        tcb->rcv_wnd_scale = _gnrc_tcp_option_ws_shift(tcb->rcv_buf.size);
+        if (tcb->rcv_wnd_scale > 0) {
+            tcb->status |= STATUS_WSCALE;
+        }
+        if (CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS > 0) {
+            tcb->status |= STATUS_SACK;
+        }
+
         /* Transition FSM to SYN_SENT */
         ret = _transition_to(tcb, FSM_STATE_SYN_SENT);
         if (ret < 0) {
@@ -441,6 +454,10 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     seg_seq = byteorder_ntohl(tcp_hdr->seq_num);
     seg_ack = byteorder_ntohl(tcp_hdr->ack_num);
     seg_wnd = byteorder_ntohs(tcp_hdr->window);
+    /* The window of a SYN is never scaled (see RFC 7323) */
+    if (!(ctl & MSK_SYN)) {
+        seg_wnd <<= tcb->snd_wnd_scale;
+    }
 
     /* Extract network layer header */
 #ifdef MODULE_GNRC_IPV6
@@ -743,11 +760,17 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                         tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
                         snp = snp->next;
                     }
+                    /* Add segments received before, that follow now */
+                    _gnrc_tcp_rcvbuf_ooo_merge(tcb);
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
+                /* Keep data behind a gap, instead of waiting for its retransmission */
+                else if (!(ctl & MSK_FIN)) {
+                    _gnrc_tcp_rcvbuf_ooo_add(tcb, snp);
+                }
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
                 if (!(ctl & MSK_FIN)) {
@@ -17,6 +17,7 @@
  * @}
  */
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_fsm.h"
 #include "include/gnrc_tcp_option.h"
 
 #define ENABLE_DEBUG 0
@@ -25,8 +26,19 @@
 int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
 {
     TCP_DEBUG_ENTER;
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+    /* Window scaling and SACK are negotiated with the SYN segments only */
+    bool syn = (ctl & MSK_SYN) && ((tcb->state == FSM_STATE_LISTEN) ||
+                                   (tcb->state == FSM_STATE_SYN_SENT));
+
+    if (syn) {
+        tcb->status &= ~(STATUS_WSCALE | STATUS_SACK);
+        tcb->snd_wnd_scale = 0;
+        tcb->rcv_wnd_scale = 0;
+    }
+
     /* Extract offset value. Return if no options are set */
-    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    uint8_t offset = GET_OFFSET(ctl);
     if (offset <= TCP_HDR_OFFSET_MIN) {
         TCP_DEBUG_LEAVE;
         return 0;
@@ -64,6 +76,42 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 tcb->mss = (option->value[0] << 8) | option->value[1];
                 break;
 
+            case TCP_OPTION_KIND_WS:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_WS) {
+                    TCP_DEBUG_ERROR("Invalid WS option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("WS option found.");
+                /* Scaling is only used if both sides scale their window */
+                if (syn && (_gnrc_tcp_option_ws_shift(tcb->rcv_buf.size) > 0)) {
+                    tcb->status |= STATUS_WSCALE;
+                    tcb->rcv_wnd_scale = _gnrc_tcp_option_ws_shift(tcb->rcv_buf.size);
+                    tcb->snd_wnd_scale = (option->value[0] > TCP_OPTION_WS_SHIFT_MAX)
+                                       ? TCP_OPTION_WS_SHIFT_MAX : option->value[0];
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+                    TCP_DEBUG_ERROR("Invalid SACK permitted option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK permitted option found.");
+                if (syn && (CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS > 0)) {
+                    tcb->status |= STATUS_SACK;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                /* Only one segment is in flight at a time, there is nothing
+                 * to be retransmitted selectively */
+                TCP_DEBUG_INFO("SACK option found.");
+                break;
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     TCP_DEBUG_INFO("Valid, unsupported option found.");
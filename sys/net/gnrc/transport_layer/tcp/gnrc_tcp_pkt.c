@@ -28,6 +28,7 @@
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_pkt.h"
+#include "include/gnrc_tcp_rcvbuf.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
@@ -173,13 +174,33 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     tcp_hdr.checksum = byteorder_htons(0);
     tcp_hdr.seq_num = byteorder_htonl(seq_num);
     tcp_hdr.ack_num = byteorder_htonl(ack_num);
-    tcp_hdr.window = byteorder_htons(tcb->rcv_wnd);
     tcp_hdr.urgent_ptr = byteorder_htons(0);
 
+    /* The window of a SYN is never scaled (see RFC 7323) */
+    uint32_t wnd = (ctl & MSK_SYN) ? tcb->rcv_wnd : (tcb->rcv_wnd >> tcb->rcv_wnd_scale);
+    tcp_hdr.window = byteorder_htons((wnd > UINT16_MAX) ? UINT16_MAX : wnd);
+
     /* Calculate option field size. */
-    /* Add MSS option if SYN is sent */
+    uint32_t sack[2 * OPTION_SACK_BLOCKS_MAX];
+    unsigned sack_blocks = 0;
+
+    /* Add MSS option and, if offered or accepted, WS and SACK permitted
+     * options if SYN is sent */
     if (ctl & MSK_SYN) {
         offset += 1;
+        if (tcb->status & STATUS_WSCALE) {
+            offset += 1;
+        }
+        if (tcb->status & STATUS_SACK) {
+            offset += 1;
+        }
+    }
+    /* Report segments received out of order with SACK blocks */
+    else if ((ctl & MSK_ACK) && (tcb->status & STATUS_SACK)) {
+        sack_blocks = _gnrc_tcp_rcvbuf_ooo_sack(tcb, sack, OPTION_SACK_BLOCKS_MAX);
+        if (sack_blocks > 0) {
+            offset += 1 + (sack_blocks * TCP_OPTION_LENGTH_SACK_BLOCK) / 4;
+        }
     }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
@@ -217,9 +238,35 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+
+                if (tcb->status & STATUS_WSCALE) {
+                    network_uint32_t ws_option = byteorder_htonl(
+                        _gnrc_tcp_option_build_ws(tcb->rcv_wnd_scale));
+
+                    memcpy(opt_ptr, &ws_option, sizeof(ws_option));
+                    opt_ptr += sizeof(ws_option);
+                }
+                if (tcb->status & STATUS_SACK) {
+                    network_uint32_t sack_perm_option = byteorder_htonl(
+                        _gnrc_tcp_option_build_sack_perm());
+
+                    memcpy(opt_ptr, &sack_perm_option, sizeof(sack_perm_option));
+                }
+            }
+            else if (sack_blocks > 0) {
+                network_uint32_t sack_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack(sack_blocks));
+
+                memcpy(opt_ptr, &sack_option, sizeof(sack_option));
+                opt_ptr += sizeof(sack_option);
+                for (unsigned i = 0; i < (2 * sack_blocks); i++) {
+                    network_uint32_t edge = byteorder_htonl(sack[i]);
+
+                    memcpy(opt_ptr, &edge, sizeof(edge));
+                    opt_ptr += sizeof(edge);
+                }
             }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
-            /* NOTE: Add additional options here */
         }
         *(out_pkt) = tcp_snp;
     }
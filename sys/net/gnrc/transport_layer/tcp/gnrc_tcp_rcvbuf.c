@@ -18,8 +18,13 @@
 #include <errno.h>
 #include <mutex.h>
 #include <stdint.h>
+#include <string.h>
+#include "byteorder.h"
+#include "net/gnrc/pktbuf.h"
 #include "net/gnrc/tcp/config.h"
+#include "net/tcp.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_rcvbuf.h"
 
 #define ENABLE_DEBUG 0
@@ -100,7 +105,10 @@ void _gnrc_tcp_rcvbuf_init(void)
 int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->rcv_buf_raw == NULL) {
+    if (tcb->status & STATUS_USER_RCV_BUF) {
+        ringbuffer_init(&tcb->rcv_buf, (char *) tcb->rcv_buf_raw, tcb->rcv_buf.size);
+    }
+    else if (tcb->rcv_buf_raw == NULL) {
         tcb->rcv_buf_raw = _rcvbuf_alloc();
         if (tcb->rcv_buf_raw == NULL) {
             TCP_DEBUG_ERROR("-ENOMEM: Failed to allocate receive buffer.");
@@ -118,9 +126,194 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->rcv_buf_raw != NULL) {
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+    for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS; ++i) {
+        if (tcb->rcv_ooo[i] != NULL) {
+            gnrc_pktbuf_release(tcb->rcv_ooo[i]);
+            tcb->rcv_ooo[i] = NULL;
+        }
+    }
+#endif
+    if ((tcb->rcv_buf_raw != NULL) && !(tcb->status & STATUS_USER_RCV_BUF)) {
         _rcvbuf_free(tcb->rcv_buf_raw);
         tcb->rcv_buf_raw = NULL;
     }
     TCP_DEBUG_LEAVE;
 }
+
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+/**
+ * @brief Get the sequence number of a received segment.
+ *
+ * @param[in] pkt   Received segment.
+ *
+ * @returns   Sequence number of @p pkt.
+ */
+static uint32_t _ooo_seq(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+
+    return byteorder_ntohl(((tcp_hdr_t *)snp->data)->seq_num);
+}
+
+/**
+ * @brief Remove a kept segment, keeping the order of the remaining ones.
+ *
+ * @param[in,out] tcb   TCB holding the kept segments.
+ * @param[in]     idx   Index of the segment to remove.
+ */
+static void _ooo_remove(gnrc_tcp_tcb_t *tcb, size_t idx)
+{
+    gnrc_pktbuf_release(tcb->rcv_ooo[idx]);
+    memmove(&tcb->rcv_ooo[idx], &tcb->rcv_ooo[idx + 1],
+            (CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS - idx - 1) * sizeof(tcb->rcv_ooo[0]));
+    tcb->rcv_ooo[CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS - 1] = NULL;
+}
+
+/**
+ * @brief Add the payload of a segment, skipping its first bytes, to the receive buffer.
+ *
+ * @param[in,out] tcb      TCB holding the receive buffer.
+ * @param[in]     pkt      Segment starting with its payload.
+ * @param[in]     offset   Number of bytes to skip.
+ *
+ * @returns   Number of bytes added to the receive buffer.
+ */
+static uint32_t _ooo_copy(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t offset)
+{
+    uint32_t added = 0;
+
+    for (gnrc_pktsnip_t *snp = pkt; (snp != NULL) && (snp->type == GNRC_NETTYPE_UNDEF);
+         snp = snp->next) {
+        if (offset >= snp->size) {
+            offset -= snp->size;
+            continue;
+        }
+        added += ringbuffer_add(&tcb->rcv_buf, (char *) snp->data + offset,
+                                snp->size - offset);
+        offset = 0;
+    }
+    return added;
+}
+#endif
+
+int _gnrc_tcp_rcvbuf_ooo_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
+{
+    TCP_DEBUG_ENTER;
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+    uint32_t seq = _ooo_seq(pkt);
+    uint32_t len = _gnrc_tcp_pkt_get_pay_len(pkt);
+
+    /* Only a segment within the window is certain to fit into the receive
+     * buffer once the gap before it is filled */
+    if ((len == 0) || !LSS_32_BIT(tcb->rcv_nxt, seq) ||
+        LSS_32_BIT(tcb->rcv_nxt + tcb->rcv_wnd, seq + len)) {
+        TCP_DEBUG_LEAVE;
+        return -ERANGE;
+    }
+    for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS; ++i) {
+        if ((tcb->rcv_ooo[i] != NULL) && (_ooo_seq(tcb->rcv_ooo[i]) == seq)) {
+            TCP_DEBUG_INFO("Segment is already kept.");
+            TCP_DEBUG_LEAVE;
+            return -EALREADY;
+        }
+    }
+    if (tcb->rcv_ooo[CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS - 1] != NULL) {
+        TCP_DEBUG_ERROR("-ENOMEM: Can't keep more segments.");
+        TCP_DEBUG_LEAVE;
+        return -ENOMEM;
+    }
+    /* Most recently received segment first, it leads the SACK blocks */
+    memmove(&tcb->rcv_ooo[1], &tcb->rcv_ooo[0],
+            (CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS - 1) * sizeof(tcb->rcv_ooo[0]));
+    gnrc_pktbuf_hold(pkt, 1);
+    tcb->rcv_ooo[0] = pkt;
+    TCP_DEBUG_LEAVE;
+    return 0;
+#else
+    (void)tcb;
+    (void)pkt;
+    TCP_DEBUG_LEAVE;
+    return -ENOMEM;
+#endif
+}
+
+void _gnrc_tcp_rcvbuf_ooo_merge(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+    size_t i = 0;
+
+    while ((i < CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS) && (tcb->rcv_ooo[i] != NULL)) {
+        gnrc_pktsnip_t *pkt = tcb->rcv_ooo[i];
+        uint32_t seq = _ooo_seq(pkt);
+        uint32_t end = seq + _gnrc_tcp_pkt_get_pay_len(pkt);
+
+        if (LSS_32_BIT(tcb->rcv_nxt, seq)) {
+            i++;
+            continue;
+        }
+        /* Segment follows or overlaps rcv_nxt, add what was not received yet */
+        if (LSS_32_BIT(tcb->rcv_nxt, end)) {
+            tcb->rcv_nxt += _ooo_copy(tcb, pkt, tcb->rcv_nxt - seq);
+        }
+        _ooo_remove(tcb, i);
+        /* rcv_nxt moved, segments already skipped may follow it now */
+        i = 0;
+    }
+#else
+    (void)tcb;
+#endif
+    TCP_DEBUG_LEAVE;
+}
+
+unsigned _gnrc_tcp_rcvbuf_ooo_sack(const gnrc_tcp_tcb_t *tcb, uint32_t *edges,
+                                   unsigned max)
+{
+    TCP_DEBUG_ENTER;
+    unsigned numof = 0;
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+    for (size_t i = 0; (i < CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS) &&
+                       (tcb->rcv_ooo[i] != NULL) && (numof < max); ++i) {
+        uint32_t left = _ooo_seq(tcb->rcv_ooo[i]);
+        uint32_t right = left + _gnrc_tcp_pkt_get_pay_len(tcb->rcv_ooo[i]);
+        bool grown = true;
+
+        /* Extend block by all kept segments adjacent or overlapping it */
+        while (grown) {
+            grown = false;
+            for (size_t j = 0; (j < CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS) &&
+                               (tcb->rcv_ooo[j] != NULL); ++j) {
+                uint32_t l = _ooo_seq(tcb->rcv_ooo[j]);
+                uint32_t r = l + _gnrc_tcp_pkt_get_pay_len(tcb->rcv_ooo[j]);
+
+                if (LEQ_32_BIT(l, right) && LEQ_32_BIT(left, r) &&
+                    (LSS_32_BIT(l, left) || LSS_32_BIT(right, r))) {
+                    left = LSS_32_BIT(l, left) ? l : left;
+                    right = LSS_32_BIT(right, r) ? r : right;
+                    grown = true;
+                }
+            }
+        }
+        /* Block was already reported for a more recently received segment */
+        bool reported = false;
+        for (unsigned k = 0; k < numof; ++k) {
+            if (edges[2 * k] == left) {
+                reported = true;
+                break;
+            }
+        }
+        if (!reported) {
+            edges[2 * numof] = left;
+            edges[(2 * numof) + 1] = right;
+            numof++;
+        }
+    }
+#else
+    (void)tcb;
+    (void)edges;
+    (void)max;
+#endif
+    TCP_DEBUG_LEAVE;
+    return numof;
+}
@@ -46,6 +46,9 @@ extern "C" {
 #define STATUS_PASSIVE        (1 << 0)
 #define STATUS_ALLOW_ANY_ADDR (1 << 1)
 #define STATUS_NOTIFY_USER    (1 << 2)
+#define STATUS_WSCALE         (1 << 3)
+#define STATUS_SACK           (1 << 4)
+#define STATUS_USER_RCV_BUF   (1 << 5)
 /** @} */
 
 /**
@@ -29,6 +29,11 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Maximum number of blocks sent in a SACK option.
+ */
+#define OPTION_SACK_BLOCKS_MAX (4U)
+
 /**
  * @brief Helper function to build the MSS option.
  *
@@ -42,6 +47,65 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Helper function to build the window scale option, padded to 32 bit.
+ *
+ * @param[in] shift   Shift count that should be set.
+ *
+ * @returns   Window scale option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_ws(uint8_t shift)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_WS << 16) |
+            ((uint32_t) TCP_OPTION_LENGTH_WS << 8) | shift);
+}
+
+/**
+ * @brief Helper function to build the SACK permitted option, padded to 32 bit.
+ *
+ * @returns   SACK permitted option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack_perm(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERM << 8) |
+            TCP_OPTION_LENGTH_SACK_PERM);
+}
+
+/**
+ * @brief Helper function to build the header of a SACK option, padded to 32 bit.
+ *
+ * @param[in] blocks   Number of blocks following the header.
+ *
+ * @returns   SACK option header value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack(uint8_t blocks)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK << 8) |
+            (TCP_OPTION_LENGTH_MIN + (blocks * TCP_OPTION_LENGTH_SACK_BLOCK)));
+}
+
+/**
+ * @brief Shift count needed to advertise a receive buffer in the window field.
+ *
+ * @param[in] size   Size of the receive buffer.
+ *
+ * @returns   Smallest shift count, that fits @p size into 16 bit.
+ */
+static inline uint8_t _gnrc_tcp_option_ws_shift(uint32_t size)
+{
+    uint8_t shift = 0;
+
+    while (((size >> shift) > UINT16_MAX) && (shift < TCP_OPTION_WS_SHIFT_MAX)) {
+        shift++;
+    }
+    return shift;
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -59,6 +123,10 @@ static inline uint16_t _gnrc_tcp_option_build_offset_control(uint16_t nopts, uin
 /**
  * @brief Parses options of a given TCP header.
  *
+ * Window scale and SACK permitted options are only taken from a SYN
+ * received in LISTEN or SYN-SENT state and only if they were or will be
+ * offered in return. Received SACK blocks are ignored.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     hdr   TCP header to be parsed.
  *
@@ -20,6 +20,7 @@
 #ifndef GNRC_TCP_RCVBUF_H
 #define GNRC_TCP_RCVBUF_H
 
+#include "net/gnrc/pkt.h"
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef __cplusplus
@@ -34,6 +35,8 @@ void _gnrc_tcp_rcvbuf_init(void);
 /**
  * @brief Allocate receive buffer and assign it to TCB.
  *
+ * A buffer set with gnrc_tcp_tcb_set_rcv_buf() is emptied and used instead.
+ *
  * @param[in,out] tcb   TCB that acquires receive buffer.
  *
  * @returns   Zero  on success.
@@ -44,10 +47,49 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
 /**
  * @brief Release allocated receive buffer.
  *
+ * Segments kept by _gnrc_tcp_rcvbuf_ooo_add() are released as well.
+ *
  * @param[in,out] tcb   TCB holding the receive buffer that should be released.
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Keep a segment received out of order until the gap before it is filled.
+ *
+ * @param[in,out] tcb   TCB the segment was received on.
+ * @param[in]     pkt   Received segment, starting with its payload. Held on success.
+ *
+ * @returns   Zero on success.
+ *            -ERANGE if the segment does not lie completely within the receive window.
+ *            -EALREADY if a segment with the same sequence number is kept already.
+ *            -ENOMEM if no more segments can be kept.
+ */
+int _gnrc_tcp_rcvbuf_ooo_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief Move kept segments, that follow rcv_nxt, into the receive buffer.
+ *
+ * Advances rcv_nxt by the amount of bytes added to the receive buffer.
+ *
+ * @param[in,out] tcb   TCB holding the kept segments.
+ */
+void _gnrc_tcp_rcvbuf_ooo_merge(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Get the SACK blocks describing the kept segments.
+ *
+ * Contiguous segments are reported as one block, the block with the most
+ * recently received segment first (see RFC 2018).
+ *
+ * @param[in]  tcb      TCB holding the kept segments.
+ * @param[out] edges    Left and right edge of each block.
+ * @param[in]  max      Maximum number of blocks to put into @p edges.
+ *
+ * @returns   Number of blocks in @p edges.
+ */
+unsigned _gnrc_tcp_rcvbuf_ooo_sack(const gnrc_tcp_tcb_t *tcb, uint32_t *edges,
+                                   unsigned max);
+
 #ifdef __cplusplus
 }
 #endif
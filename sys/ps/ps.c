@@ -17,13 +17,16 @@
 
 #include <stdio.h>
 #include <assert.h>
+#include <inttypes.h>
 
+#include "irq.h"
 #include "thread.h"
 #include "sched.h"
 #include "thread.h"
 #include "kernel_types.h"
 
 #ifdef MODULE_SCHEDSTATISTICS
+#include "fmt.h"
 #include "schedstatistics.h"
 #endif
 
@@ -117,7 +120,7 @@ void ps(void)
     for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
         thread_t *p = thread_get(i);
         if (p != NULL) {
-            rt_sum += sched_pidlist[i].runtime_ticks;
+            rt_sum += sched_pidlist[i].runtime_us;
         }
     }
 #endif /* MODULE_SCHEDSTATISTICS */
@@ -138,9 +141,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
             /* multiply with 100 for percentage and to avoid floats/doubles */
-            uint64_t runtime_ticks = sched_pidlist[i].runtime_ticks * 100;
-            unsigned runtime_major = runtime_ticks / rt_sum;
-            unsigned runtime_minor = ((runtime_ticks % rt_sum) * 1000) / rt_sum;
+            uint64_t runtime_us = sched_pidlist[i].runtime_us * 100;
+            unsigned runtime_major = runtime_us / rt_sum;
+            unsigned runtime_minor = ((runtime_us % rt_sum) * 1000) / rt_sum;
             unsigned switches = sched_pidlist[i].schedules;
 #endif
             printf("\t%3" PRIkernel_pid
@@ -183,3 +186,71 @@ void ps(void)
 #   endif
 #endif
 }
+
+#ifdef MODULE_SCHEDSTATISTICS
+static const char *_u64_to_str(char *buf, uint64_t val)
+{
+    buf[fmt_u64_dec(buf, val)] = '\0';
+    return buf;
+}
+
+static void _print_schedstat(const schedstat_t *stat)
+{
+    char buf[21];
+
+    printf(", \"runtime_us\" : %s, \"switches\" : %u"
+           ", \"voluntary\" : %u, \"involuntary\" : %u"
+           ", \"latency_max_us\" : %" PRIu32 ", \"latency_hist\" : [",
+           _u64_to_str(buf, stat->runtime_us), stat->schedules,
+           stat->voluntary, stat->involuntary, stat->latency_max);
+    for (unsigned i = 0; i < CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS; i++) {
+        printf("%s%u", i ? ", " : "", stat->latency[i]);
+    }
+    printf("]");
+}
+#endif /* MODULE_SCHEDSTATISTICS */
+
+void ps_json(void)
+{
+#ifdef MODULE_SCHEDSTATISTICS
+    /* take a consistent snapshot of the scheduler statistics */
+    unsigned state = irq_disable();
+    schedstat_isr_t isrstat = sched_isrstat;
+    irq_restore(state);
+
+    char buf[21];
+    printf("{ \"isr\" : { \"runtime_us\" : %s, \"count\" : %u } }\n",
+           _u64_to_str(buf, isrstat.runtime_us), isrstat.count);
+#endif
+
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        thread_t *p = thread_get(i);
+
+        if (p == NULL) {
+            continue;
+        }
+
+        printf("{ \"pid\" : %" PRIkernel_pid
+#ifdef CONFIG_THREAD_NAMES
+               ", \"name\" : \"%s\""
+#endif
+               ", \"state\" : \"%s\", \"priority\" : %u",
+               p->pid,
+#ifdef CONFIG_THREAD_NAMES
+               p->name,
+#endif
+               state_to_string(p->status), p->priority);
+#ifdef DEVELHELP
+        int stack_free = thread_measure_stack_free(p->stack_start);
+        printf(", \"stack_size\" : %i, \"stack_free\" : %i",
+               p->stack_size, stack_free);
+#endif
+#ifdef MODULE_SCHEDSTATISTICS
+        state = irq_disable();
+        schedstat_t stat = sched_pidlist[i];
+        irq_restore(state);
+        _print_schedstat(&stat);
+#endif
+        puts(" }");
+    }
+}
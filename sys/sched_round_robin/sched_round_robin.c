@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_round_robin
+ * @{
+ *
+ * @file
+ * @brief       Round robin time slicing implementation
+ *
+ * @}
+ */
+
+#include "irq.h"
+#include "sched.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#include "sched_round_robin.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* marks that no time slice timer is armed */
+#define SCHED_RR_PRIO_NONE      (0xff)
+
+static void _sched_round_robin_cb(void *arg);
+
+static ztimer_t _rr_timer = { .callback = _sched_round_robin_cb };
+static uint8_t _rr_prio = SCHED_RR_PRIO_NONE;
+
+static void _sched_round_robin_cb(void *arg)
+{
+    (void)arg;
+
+    uint8_t prio = _rr_prio;
+    _rr_prio = SCHED_RR_PRIO_NONE;
+
+    thread_t *active = thread_get_active();
+
+    /* only preempt if the running thread is still the head of the runqueue
+     * that got armed, otherwise it blocked or was preempted in the meantime */
+    if (active && (active->priority == prio) &&
+        (active->status == STATUS_RUNNING) &&
+        sched_runq_more_than_one(prio) &&
+        (clist_lpeek(&sched_runqueues[prio]) == &active->rq_entry)) {
+        DEBUG("sched_rr: slice of %" PRIkernel_pid " expired\n", active->pid);
+        sched_runq_advance(prio);
+        /* the next slice is armed by sched_runq_callback() on sched_run() */
+        thread_yield_higher();
+    }
+}
+
+void sched_runq_callback(uint8_t prio)
+{
+    (void)prio;
+
+    /* only the runqueue of the running thread matters: slice if it shares
+     * its priority with other runnable threads, otherwise stay tickless */
+    thread_t *active = thread_get_active();
+
+    if (!active) {
+        return;
+    }
+
+    uint8_t active_prio = active->priority;
+
+    if ((SCHED_RR_MASK & (1UL << active_prio)) ||
+        !sched_runq_more_than_one(active_prio)) {
+        if (_rr_prio != SCHED_RR_PRIO_NONE) {
+            _rr_prio = SCHED_RR_PRIO_NONE;
+            ztimer_remove(SCHED_RR_TIMERBASE, &_rr_timer);
+        }
+        return;
+    }
+
+    if (_rr_prio != active_prio) {
+        _rr_prio = active_prio;
+        ztimer_set(SCHED_RR_TIMERBASE, &_rr_timer, SCHED_RR_TIMEOUT);
+    }
+}
+
+void sched_round_robin_init(void)
+{
+    unsigned state = irq_disable();
+    thread_t *active = thread_get_active();
+
+    if (active) {
+        sched_runq_callback(active->priority);
+    }
+    irq_restore(state);
+}
@@ -21,21 +21,61 @@
  * @}
  */
 
+#include <stdbool.h>
+
+#include "bitarithm.h"
+#include "irq.h"
 #include "sched.h"
 #include "schedstatistics.h"
 #include "thread.h"
-#include "xtimer.h"
+#include "ztimer.h"
 
 schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
+schedstat_isr_t sched_isrstat;
+
+/* the wakeup and ISR hooks are called before ZTIMER_USEC is initialized */
+static bool _enabled;
+
+static inline uint32_t _now(void)
+{
+    return ztimer_now(ZTIMER_USEC);
+}
+
+static void _record_latency(schedstat_t *stat, uint32_t latency)
+{
+    unsigned bucket = 0;
+
+    if (latency >> CONFIG_SCHEDSTATISTICS_LATENCY_SHIFT) {
+        bucket = bitarithm_msb(latency >> CONFIG_SCHEDSTATISTICS_LATENCY_SHIFT) + 1;
+        if (bucket >= CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS) {
+            bucket = CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS - 1;
+        }
+    }
+
+    stat->latency[bucket]++;
+    if (latency > stat->latency_max) {
+        stat->latency_max = latency;
+    }
+}
 
 void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
 {
-    uint32_t now = xtimer_now().ticks32;
+    uint32_t now = _now();
 
     /* Update active thread stats */
     if (active_thread != KERNEL_PID_UNDEF) {
         schedstat_t *active_stat = &sched_pidlist[active_thread];
-        active_stat->runtime_ticks += now - active_stat->laststart;
+        active_stat->runtime_us += now - active_stat->laststart;
+
+        thread_t *active = thread_get(active_thread);
+        if (active && (active_thread != next_thread)) {
+            if (active->status >= STATUS_ON_RUNQUEUE) {
+                active_stat->involuntary++;
+            }
+            else {
+                active_stat->voluntary++;
+            }
+        }
     }
 
     /* Update next_thread stats */
@@ -43,15 +83,57 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
         schedstat_t *next_stat = &sched_pidlist[next_thread];
         next_stat->laststart = now;
         next_stat->schedules++;
+        if (next_stat->woken) {
+            next_stat->woken = 0;
+            _record_latency(next_stat, now - next_stat->wakeup);
+        }
+    }
+}
+
+void sched_wakeup_callback(thread_t *thread)
+{
+    if (_enabled) {
+        schedstat_t *stat = &sched_pidlist[thread->pid];
+        stat->wakeup = _now();
+        stat->woken = 1;
+    }
+}
+
+void sched_statistics_isr_enter(void)
+{
+    if (_enabled && (sched_isrstat.nesting++ == 0)) {
+        sched_isrstat.laststart = _now();
+    }
+}
+
+void sched_statistics_isr_exit(void)
+{
+    if (!_enabled || !sched_isrstat.nesting || --sched_isrstat.nesting) {
+        return;
+    }
+
+    uint32_t elapsed = _now() - sched_isrstat.laststart;
+    sched_isrstat.runtime_us += elapsed;
+    sched_isrstat.count++;
+
+    /* don't account the time spent in the ISR to the interrupted thread */
+    kernel_pid_t pid = thread_getpid();
+    if (pid != KERNEL_PID_UNDEF) {
+        sched_pidlist[pid].laststart += elapsed;
     }
 }
 
 void init_schedstatistics(void)
 {
+    unsigned state = irq_disable();
+
     /* Init laststart for the thread starting schedstatistics since the callback
        wasn't registered when it was first scheduled */
     schedstat_t *active_stat = &sched_pidlist[thread_getpid()];
-    active_stat->laststart = xtimer_now().ticks32;
+    active_stat->laststart = _now();
     active_stat->schedules = 1;
     sched_register_cb(sched_statistics_cb);
+    _enabled = true;
+
+    irq_restore(state);
 }
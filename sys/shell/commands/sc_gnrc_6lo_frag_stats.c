@@ -27,6 +27,9 @@ int _gnrc_6lo_frag_stats(int argc, char **argv)
     printf("frag full: %u\n", stats->frag_full);
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     printf("VRB full: %u\n", stats->vrb_full);
+#endif
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD
+    printf("frags forwarded: %u\n", stats->fwd_fragments);
 #endif
     printf("frags complete: %u\n", stats->fragments);
     printf("dgs complete: %u\n", stats->datagrams);
@@ -162,18 +162,23 @@ static int _netif_stats(netif_t *iface, unsigned module, bool reset)
         printf("Reset statistics for module %s!\n", _netstats_module_to_str(module));
     }
     else {
+        unsigned tx_count = stats->tx_unicast_count + stats->tx_mcast_count;
+
         printf("          Statistics for %s\n"
                "            RX packets %u  bytes %u\n"
                "            TX packets %u (Multicast: %u)  bytes %u\n"
-               "            TX succeeded %u errors %u\n",
+               "            TX succeeded %u errors %u\n"
+               "            TX copied bytes %u (%u per packet)\n",
                _netstats_module_to_str(module),
                (unsigned) stats->rx_count,
                (unsigned) stats->rx_bytes,
-               (unsigned) (stats->tx_unicast_count + stats->tx_mcast_count),
+               tx_count,
                (unsigned) stats->tx_mcast_count,
                (unsigned) stats->tx_bytes,
                (unsigned) stats->tx_success,
-               (unsigned) stats->tx_failed);
+               (unsigned) stats->tx_failed,
+               (unsigned) stats->tx_copied_bytes,
+               tx_count ? (unsigned) stats->tx_copied_bytes / tx_count : 0);
         res = 0;
     }
     return res;
@@ -18,14 +18,23 @@
  * @}
  */
 
+#include <stdio.h>
+#include <string.h>
+
 #include "ps.h"
 
 int _ps_handler(int argc, char **argv)
 {
-    (void) argc;
-    (void) argv;
-
-    ps();
+    if ((argc > 1) && (strcmp(argv[1], "json") == 0)) {
+        ps_json();
+    }
+    else if (argc > 1) {
+        printf("usage: %s [json]\n", argv[0]);
+        return 1;
+    }
+    else {
+        ps();
+    }
 
     return 0;
 }
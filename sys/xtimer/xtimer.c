@@ -224,6 +224,8 @@ static void _mutex_remove_thread_from_waiting_queue(mutex_t *mutex, thread_t *th
             if (mutex->queue.next == NULL) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
+            /* the owner might have inherited the thread's priority */
+            _mutex_update_owner_priority(mutex);
             *unlocked = 1;
 
             sched_set_status(thread, STATUS_PENDING);
@@ -262,6 +264,7 @@ static int _mutex_lock_internal(mutex_t *mutex, volatile uint8_t *blocking)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+        _mutex_set_owner(mutex);
         DEBUG("PID[%" PRIkernel_pid "]: mutex_wait early out.\n",
               thread_getpid());
         irq_restore(irqstate);
@@ -279,6 +282,7 @@ static int _mutex_lock_internal(mutex_t *mutex, volatile uint8_t *blocking)
         else {
             thread_add_to_list(&mutex->queue, me);
         }
+        _mutex_inherit_priority(mutex);
         irq_restore(irqstate);
         thread_yield_higher();
         /* We were woken up by scheduler. Waker removed us from queue.
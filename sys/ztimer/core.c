@@ -23,6 +23,8 @@
  * @}
  */
 #include <assert.h>
+#include <limits.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "kernel_defines.h"
@@ -30,6 +32,9 @@
 #ifdef MODULE_PM_LAYERED
 #include "pm_layered.h"
 #endif
+#ifdef MODULE_ZTIMER_WHEEL
+#include "bitarithm.h"
+#endif
 #include "ztimer.h"
 
 #define ENABLE_DEBUG 0
@@ -47,23 +52,338 @@ static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 }
 #endif
 
+#ifdef MODULE_ZTIMER_WHEEL
+#if (CONFIG_ZTIMER_WHEEL_SHIFT + 5 * CONFIG_ZTIMER_WHEEL_LEVELS) > 32
+#error "ztimer_wheel: CONFIG_ZTIMER_WHEEL_SHIFT or _LEVELS too large"
+#endif
+
+/* The list of a wheel slot is circular and doubly linked, and the slot points
+ * to its last timer, so that timers are appended and removed in O(1) and keep
+ * their order when moved down. This also keeps the next pointer of a timer in
+ * the wheel from being NULL, so _is_set() works for those as well. Timers in
+ * the sorted list have their prev pointer cleared. */
+
+static inline unsigned _wheel_shift(unsigned level)
+{
+    /* ZTIMER_WHEEL_SLOTS == 2^5 */
+    return CONFIG_ZTIMER_WHEEL_SHIFT + 5 * level;
+}
+
+static inline unsigned _lsb32(uint32_t v)
+{
+#if UINT_MAX < UINT32_MAX
+    if (!(v & 0xffff)) {
+        return 16 + bitarithm_lsb(v >> 16);
+    }
+    return bitarithm_lsb(v & 0xffff);
+#else
+    return bitarithm_lsb(v);
+#endif
+}
+
+static bool _wheel_used(const ztimer_clock_t *clock)
+{
+    for (unsigned level = 0; level < CONFIG_ZTIMER_WHEEL_LEVELS; level++) {
+        if (clock->wheel.bitmap[level]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Get the time of the next non-empty slot after the last processed one */
+static bool _wheel_next(const ztimer_clock_t *clock, uint32_t *next)
+{
+    const ztimer_wheel_t *wheel = &clock->wheel;
+    bool found = false;
+
+    for (unsigned level = 0; level < CONFIG_ZTIMER_WHEEL_LEVELS; level++) {
+        uint32_t bitmap = wheel->bitmap[level];
+        if (!bitmap) {
+            continue;
+        }
+
+        unsigned shift = _wheel_shift(level);
+        uint32_t slot = (wheel->pos >> shift) + 1;
+        unsigned rot = slot & (ZTIMER_WHEEL_SLOTS - 1);
+        if (rot) {
+            bitmap = (bitmap >> rot) | (bitmap << (32 - rot));
+        }
+
+        uint32_t target = (slot + _lsb32(bitmap)) << shift;
+        if (!found || ((target - wheel->pos) < (*next - wheel->pos))) {
+            *next = target;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+/* Puts an entry due in @p val ticks into the wheel. Returns false if the
+ * entry is due too soon, in which case it has to be added to the list. */
+static bool _wheel_add(ztimer_clock_t *clock, ztimer_base_t *entry,
+                       uint32_t val)
+{
+    ztimer_wheel_t *wheel = &clock->wheel;
+    uint32_t now = clock->list.offset;
+    uint32_t target = now + val;
+
+    if (!_wheel_used(clock)) {
+        if (val < (1UL << CONFIG_ZTIMER_WHEEL_SHIFT)) {
+            return false;
+        }
+        wheel->pos = now & ~((1UL << CONFIG_ZTIMER_WHEEL_SHIFT) - 1);
+    }
+    else if (val < (1UL << CONFIG_ZTIMER_WHEEL_SHIFT)) {
+        /* near timers may skip the wheel unless one that is already in there
+         * could be due at the same time, which would then fire after them */
+        uint32_t next;
+        _wheel_next(clock, &next);
+        if ((int32_t)(target - next) < 0) {
+            return false;
+        }
+    }
+
+    if ((target >> CONFIG_ZTIMER_WHEEL_SHIFT) ==
+        (wheel->pos >> CONFIG_ZTIMER_WHEEL_SHIFT)) {
+        return false;
+    }
+
+    /* use the lowest level on which the target is in the same span as the
+     * last processed slot, timers beyond the top level's span stay on the top
+     * level for more than one round */
+    unsigned level = 0;
+    while ((level < CONFIG_ZTIMER_WHEEL_LEVELS - 1) &&
+           ((target >> _wheel_shift(level + 1)) !=
+            (wheel->pos >> _wheel_shift(level + 1)))) {
+        level++;
+    }
+
+    unsigned slot = (target >> _wheel_shift(level)) & (ZTIMER_WHEEL_SLOTS - 1);
+    ztimer_base_t **tail = &wheel->slots[level][slot];
+
+    /* timers in the wheel store their absolute target */
+    entry->offset = target;
+    if (*tail) {
+        entry->next = (*tail)->next;
+        entry->prev = *tail;
+        entry->next->prev = entry;
+        (*tail)->next = entry;
+    }
+    else {
+        entry->next = entry;
+        entry->prev = entry;
+    }
+    *tail = entry;
+    wheel->bitmap[level] |= 1UL << slot;
+
+    DEBUG("_wheel_add() %p target %" PRIu32 " level %u slot %u\n",
+          (void *)entry, target, level, slot);
+
+    return true;
+}
+
+/* Removes an entry from the wheel. Only the last timer of a slot is pointed
+ * to by the slot, which is found among the slots its target maps to on each
+ * level. */
+static void _wheel_del(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_wheel_t *wheel = &clock->wheel;
+
+    for (unsigned level = 0; level < CONFIG_ZTIMER_WHEEL_LEVELS; level++) {
+        unsigned slot = (entry->offset >> _wheel_shift(level)) &
+                        (ZTIMER_WHEEL_SLOTS - 1);
+        if (wheel->slots[level][slot] == entry) {
+            if (entry->next == entry) {
+                wheel->slots[level][slot] = NULL;
+                wheel->bitmap[level] &= ~(1UL << slot);
+            }
+            else {
+                wheel->slots[level][slot] = entry->prev;
+            }
+            break;
+        }
+    }
+
+    entry->prev->next = entry->next;
+    entry->next->prev = entry->prev;
+    entry->next = NULL;
+    entry->prev = NULL;
+}
+
+static void _wheel_handler(void *arg);
+
+/* (Re-)set the wheel's timer to the next non-empty slot. Requires the head
+ * offset to be up to date. */
+static void _wheel_schedule(ztimer_clock_t *clock)
+{
+    ztimer_wheel_t *wheel = &clock->wheel;
+    uint32_t next;
+    bool pending = _wheel_next(clock, &next);
+
+    if (wheel->armed && !(pending && (next == wheel->next))) {
+        _del_entry_from_list(clock, &wheel->timer.base);
+        wheel->armed = 0;
+    }
+
+    if (pending && !wheel->armed) {
+        uint32_t now = clock->list.offset;
+
+        wheel->next = next;
+        wheel->timer.callback = _wheel_handler;
+        wheel->timer.arg = clock;
+        wheel->timer.base.offset = ((int32_t)(next - now) > 0) ? next - now : 0;
+        _add_entry_to_list(clock, &wheel->timer.base);
+        wheel->armed = 1;
+    }
+}
+
+static void _wheel_handler(void *arg)
+{
+    ztimer_clock_t *clock = arg;
+    ztimer_wheel_t *wheel = &clock->wheel;
+    unsigned state = irq_disable();
+
+    uint32_t pos = wheel->next;
+
+    wheel->armed = 0;
+    wheel->pos = pos;
+    ztimer_update_head_offset(clock);
+
+    uint32_t late = clock->list.offset - pos;
+
+    /* process the slots starting at this time on all levels, top down, as
+     * timers of a higher level slot may move into a lower level one */
+    for (unsigned level = CONFIG_ZTIMER_WHEEL_LEVELS; level-- > 0;) {
+        unsigned shift = _wheel_shift(level);
+        if (pos & ((1UL << shift) - 1)) {
+            continue;
+        }
+
+        unsigned slot = (pos >> shift) & (ZTIMER_WHEEL_SLOTS - 1);
+        ztimer_base_t *tail = wheel->slots[level][slot];
+        ztimer_base_t *entry = tail ? tail->next : NULL;
+        wheel->slots[level][slot] = NULL;
+        wheel->bitmap[level] &= ~(1UL << slot);
+
+        /* move the timers in their order, so that timers due at the same
+         * time still fire in the order they were set */
+        while (entry) {
+            ztimer_base_t *next = (entry == tail) ? NULL : entry->next;
+            uint32_t val = entry->offset - pos;
+
+            val = (val > late) ? val - late : 0;
+            if (!_wheel_add(clock, entry, val)) {
+                entry->offset = val;
+                _add_entry_to_list(clock, entry);
+            }
+            entry = next;
+        }
+    }
+
+    _wheel_schedule(clock);
+
+    irq_restore(state);
+}
+
+/* Narrows @p best down to the distance from @p target to the first timer of a
+ * wheel slot that is due within @p best ticks from @p target */
+static bool _wheel_slot_coalesce(const ztimer_clock_t *clock, unsigned level,
+                                 unsigned slot, uint32_t target, uint32_t *best)
+{
+    const ztimer_base_t *tail = clock->wheel.slots[level][slot];
+    const ztimer_base_t *entry = tail;
+    bool found = false;
+
+    if (!(clock->wheel.bitmap[level] & (1UL << slot))) {
+        return false;
+    }
+
+    do {
+        entry = entry->next;
+        uint32_t diff = entry->offset - target;
+        if (diff <= *best) {
+            *best = diff;
+            found = true;
+        }
+    } while (entry != tail);
+
+    return found;
+}
+
+/* Get the first time within [val, val + slack] at which a timer in the wheel
+ * is due, or val if there is none. Only the slots that both ends of the window
+ * map to are searched on each level, so with a slack wider than a slot a timer
+ * in a slot in between can be missed. */
+static uint32_t _wheel_coalesce(const ztimer_clock_t *clock, uint32_t val,
+                                uint32_t slack)
+{
+    uint32_t target = clock->list.offset + val;
+    uint32_t best = slack;
+    bool found = false;
+
+    for (unsigned level = 0; level < CONFIG_ZTIMER_WHEEL_LEVELS; level++) {
+        unsigned shift = _wheel_shift(level);
+        unsigned first = (target >> shift) & (ZTIMER_WHEEL_SLOTS - 1);
+        unsigned last = ((target + slack) >> shift) & (ZTIMER_WHEEL_SLOTS - 1);
+
+        found |= _wheel_slot_coalesce(clock, level, first, target, &best);
+        if (last != first) {
+            found |= _wheel_slot_coalesce(clock, level, last, target, &best);
+        }
+    }
+
+    return found ? val + best : val;
+}
+
+static inline bool _head_changed(const ztimer_clock_t *clock,
+                                 const ztimer_base_t *head,
+                                 uint32_t head_offset)
+{
+    return (clock->list.next != head) ||
+           (head && (head->offset != head_offset));
+}
+#endif /* MODULE_ZTIMER_WHEEL */
+
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
     if (!clock->list.next) {
+#ifdef MODULE_ZTIMER_WHEEL
+        /* the wheel's timer might just be being handled */
+        return t->base.next && _wheel_used(clock);
+#else
         return 0;
+#endif
     }
     else {
         return (t->base.next || &t->base == clock->last);
     }
 }
 
+static void _del_entry(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+#ifdef MODULE_ZTIMER_WHEEL
+    if (entry->prev) {
+        _wheel_del(clock, entry);
+        _wheel_schedule(clock);
+        return;
+    }
+    if (!clock->list.next) {
+        entry->next = NULL;
+        return;
+    }
+#endif
+    _del_entry_from_list(clock, entry);
+}
+
 void ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
 {
     unsigned state = irq_disable();
 
     if (_is_set(clock, timer)) {
         ztimer_update_head_offset(clock);
-        _del_entry_from_list(clock, &timer->base);
+        _del_entry(clock, &timer->base);
 
         _ztimer_update(clock);
     }
@@ -71,16 +391,48 @@ void ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
     irq_restore(state);
 }
 
-void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+/* Get the first time within [val, val + slack] at which another timer is due,
+ * or val if there is none */
+static uint32_t _coalesce(const ztimer_clock_t *clock, uint32_t val,
+                          uint32_t slack)
+{
+    uint32_t target = 0;
+
+    for (const ztimer_base_t *entry = clock->list.next; entry;
+         entry = entry->next) {
+        target += entry->offset;
+        if (target >= val) {
+            if (target - val <= slack) {
+                return target;
+            }
+            break;
+        }
+    }
+
+#ifdef MODULE_ZTIMER_WHEEL
+    return _wheel_coalesce(clock, val, slack);
+#else
+    return val;
+#endif
+}
+
+static void _set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val,
+                 uint32_t slack)
 {
-    DEBUG("ztimer_set(): %p: set %p at %" PRIu32 " offset %" PRIu32 "\n",
-          (void *)clock, (void *)timer, clock->ops->now(clock), val);
+    DEBUG("ztimer_set(): %p: set %p at %" PRIu32 " offset %" PRIu32
+          " slack %" PRIu32 "\n",
+          (void *)clock, (void *)timer, clock->ops->now(clock), val, slack);
 
     unsigned state = irq_disable();
 
     ztimer_update_head_offset(clock);
+#ifdef MODULE_ZTIMER_WHEEL
+    /* the wheel's timer might be moved without changing the list head */
+    ztimer_base_t *head = clock->list.next;
+    uint32_t head_offset = head ? head->offset : 0;
+#endif
     if (_is_set(clock, timer)) {
-        _del_entry_from_list(clock, &timer->base);
+        _del_entry(clock, &timer->base);
     }
 
     /* optionally subtract a configurable adjustment value */
@@ -91,6 +443,21 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
         val = 0;
     }
 
+    if (slack) {
+        val = _coalesce(clock, val, slack);
+    }
+
+#ifdef MODULE_ZTIMER_WHEEL
+    if (_wheel_add(clock, &timer->base, val)) {
+        _wheel_schedule(clock);
+        if (_head_changed(clock, head, head_offset)) {
+            _ztimer_update(clock);
+        }
+        irq_restore(state);
+        return;
+    }
+#endif
+
     timer->base.offset = val;
     _add_entry_to_list(clock, &timer->base);
     if (clock->list.next == &timer->base) {
@@ -102,16 +469,36 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
 #endif
         clock->ops->set(clock, val);
     }
+#ifdef MODULE_ZTIMER_WHEEL
+    else if (_head_changed(clock, head, head_offset)) {
+        _ztimer_update(clock);
+    }
+#endif
 
     irq_restore(state);
 }
 
+void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+{
+    _set(clock, timer, val, 0);
+}
+
+void ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                           uint32_t val, uint32_t slack)
+{
+    _set(clock, timer, val, slack);
+}
+
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 {
     uint32_t delta_sum = 0;
 
     ztimer_base_t *list = &clock->list;
 
+#ifdef MODULE_ZTIMER_WHEEL
+    entry->prev = NULL;
+#endif
+
 #ifdef MODULE_PM_LAYERED
     /* First timer on the clock's linked list */
     if (list->next == NULL &&
@@ -309,6 +696,9 @@ static void _ztimer_update(ztimer_clock_t *clock)
 
 void ztimer_handler(ztimer_clock_t *clock)
 {
+#ifdef MODULE_ZTIMER_OVERHEAD
+    clock->wakeups++;
+#endif
     DEBUG("ztimer_handler(): %p now=%" PRIu32 "\n", (void *)clock, clock->ops->now(
               clock));
     if (IS_ACTIVE(ENABLE_DEBUG)) {
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     sys_ztimer
+ * @{
+ *
+ * @file
+ * @brief       ztimer 64 bit epoch extension
+ *
+ * @}
+ */
+
+#include "irq.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* reading the clock at least once every 2^32 ticks is enough to notice every
+ * wraparound, reading it every 2^31 ticks leaves plenty of room for latency */
+#define EPOCH_INTERVAL  (1UL << 31)
+
+static void _epoch_timer_set(ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_USEC && MODULE_ZTIMER_MSEC
+    /* keeping a timer on ZTIMER_USEC set for the whole uptime would block
+     * its power mode, ZTIMER_MSEC can wake up just as well */
+    if (clock == ZTIMER_USEC) {
+        ztimer_set(ZTIMER_MSEC, &clock->epoch_timer,
+                   EPOCH_INTERVAL / US_PER_MS);
+        return;
+    }
+#endif
+    ztimer_set(clock, &clock->epoch_timer, EPOCH_INTERVAL);
+}
+
+static void _epoch_callback(void *arg)
+{
+    ztimer_clock_t *clock = arg;
+
+    _ztimer_now64_epoch(clock);
+    _epoch_timer_set(clock);
+}
+
+uint64_t _ztimer_now64_epoch(ztimer_clock_t *clock)
+{
+    unsigned state = irq_disable();
+    uint32_t now = ztimer_now(clock);
+
+    if (now < clock->epoch_last) {
+        clock->epoch++;
+    }
+    clock->epoch_last = now;
+
+    if (!clock->epoch_timer.callback) {
+        clock->epoch_timer.callback = _epoch_callback;
+        clock->epoch_timer.arg = clock;
+        _epoch_timer_set(clock);
+    }
+
+    uint64_t res = ((uint64_t)clock->epoch << 32) | now;
+    irq_restore(state);
+
+    return res;
+}
@@ -48,3 +48,13 @@ int32_t ztimer_overhead(ztimer_clock_t *clock, uint32_t base)
     while (!after) {}
     return after - pre - base;
 }
+
+uint32_t ztimer_overhead_wakeups(ztimer_clock_t *clock, uint32_t duration)
+{
+    volatile uint32_t *wakeups = &clock->wakeups;
+    uint32_t before = *wakeups;
+    uint32_t start = ztimer_now(clock);
+
+    while (ztimer_now(clock) - start < duration) {}
+    return *wakeups - before;
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure event queue throughput and post-to-handle latency
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "event.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION           (1000000U)
+#endif
+
+/* number of events posted at once in the throughput test */
+#ifndef TEST_BATCH
+#define TEST_BATCH              (16U)
+#endif
+
+/* period at which an event is posted from ISR in the latency test */
+#ifndef TEST_LATENCY_PERIOD_US
+#define TEST_LATENCY_PERIOD_US  (1000U)
+#endif
+
+/* number of latency measurements */
+#ifndef TEST_LATENCY_RUNS
+#define TEST_LATENCY_RUNS       (1000U)
+#endif
+
+#define THREAD_FLAG_DONE        (0x2)
+
+static volatile unsigned _flag = 0;
+static volatile uint32_t _handled = 0;
+static volatile uint32_t _stamp;
+static uint32_t _latency_max;
+static uint32_t _latency_sum;
+static unsigned _latency_runs;
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static event_queue_t _queue = EVENT_QUEUE_INIT_DETACHED;
+static thread_t *_main;
+static xtimer_t _timer;
+
+static void _batch_handler(event_t *event);
+static void _latency_handler(event_t *event);
+
+static event_t _events[TEST_BATCH];
+static event_t _latency_event = { .handler = _latency_handler };
+
+static void _batch_handler(event_t *event)
+{
+    _handled++;
+    if (event == &_events[TEST_BATCH - 1]) {
+        thread_flags_set(_main, THREAD_FLAG_DONE);
+    }
+}
+
+static void _latency_handler(event_t *event)
+{
+    (void)event;
+
+    uint32_t latency = xtimer_now_usec() - _stamp;
+
+    _latency_sum += latency;
+    if (latency > _latency_max) {
+        _latency_max = latency;
+    }
+    if (++_latency_runs == TEST_LATENCY_RUNS) {
+        thread_flags_set(_main, THREAD_FLAG_DONE);
+    }
+}
+
+static void _timer_callback(void *arg)
+{
+    (void)arg;
+
+    _flag = 1;
+}
+
+static void _latency_timer_callback(void *arg)
+{
+    (void)arg;
+
+    _stamp = xtimer_now_usec();
+    event_post(&_queue, &_latency_event);
+    if (_latency_runs < TEST_LATENCY_RUNS - 1) {
+        xtimer_set(&_timer, TEST_LATENCY_PERIOD_US);
+    }
+}
+
+static void *_consumer(void *arg)
+{
+    (void)arg;
+
+    event_queue_claim(&_queue);
+    event_loop(&_queue);
+
+    return NULL;
+}
+
+static void _measure_throughput(void)
+{
+    _flag = 0;
+    _handled = 0;
+
+    _timer.callback = _timer_callback;
+    xtimer_set(&_timer, TEST_DURATION);
+
+    while (!_flag) {
+        for (unsigned i = 0; i < TEST_BATCH; i++) {
+            event_post(&_queue, &_events[i]);
+        }
+        thread_flags_wait_any(THREAD_FLAG_DONE);
+    }
+
+    printf("{ \"events_per_sec\" : %" PRIu32 " }\n", _handled);
+}
+
+static void _measure_latency(void)
+{
+    _latency_max = 0;
+    _latency_sum = 0;
+    _latency_runs = 0;
+
+    _timer.callback = _latency_timer_callback;
+    xtimer_set(&_timer, TEST_LATENCY_PERIOD_US);
+    thread_flags_wait_any(THREAD_FLAG_DONE);
+
+    printf("{ \"latency_max_us\" : %" PRIu32 ", \"latency_avg_us\" : %" PRIu32
+           " }\n", _latency_max, _latency_sum / TEST_LATENCY_RUNS);
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    _main = thread_get_active();
+    for (unsigned i = 0; i < TEST_BATCH; i++) {
+        _events[i].handler = _batch_handler;
+    }
+
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN + 1,
+                  THREAD_CREATE_STACKTEST, _consumer, NULL, "consumer");
+
+    _measure_throughput();
+    _measure_latency();
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure forwarding table lookups with a growing number of
+ *              routes
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "byteorder.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/ipv6/addr.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define TEST_MAX_ROUTES         CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF
+
+/* number of lookups measured per route count */
+#ifndef TEST_REPS
+#define TEST_REPS               (1024U)
+#endif
+
+/* interface the routes point to; it does not need to exist */
+#define TEST_IFACE              (6U)
+
+static const ipv6_addr_t _next_hop = { .u8 = {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01
+    }
+};
+static const ipv6_addr_t _unrouted = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01
+    }
+};
+
+/* host route 2001:db8::<n + 1>, as RPL installs them for downward routes */
+static void _route_dst(ipv6_addr_t *dst, unsigned n)
+{
+    ipv6_addr_from_str(dst, "2001:db8::");
+    dst->u16[7] = byteorder_htons(n + 1);
+}
+
+static void _bench(unsigned count)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    ipv6_addr_t dst;
+    unsigned found = 0;
+
+    for (unsigned i = 0; i < count; i++) {
+        _route_dst(&dst, i);
+        if (gnrc_ipv6_nib_ft_add(&dst, IPV6_ADDR_BIT_LEN, &_next_hop,
+                                 TEST_IFACE, 0) < 0) {
+            printf("error: unable to add route %u\n", i);
+            return;
+        }
+    }
+
+    /* look up each routed address in turn */
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        _route_dst(&dst, i % count);
+        if (gnrc_ipv6_nib_ft_get(&dst, NULL, &fte) == 0) {
+            found++;
+        }
+    }
+    uint32_t lookup_us = ztimer_now(ZTIMER_USEC) - start;
+
+    /* look up an address no route matches */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        if (gnrc_ipv6_nib_ft_get(&_unrouted, NULL, &fte) == 0) {
+            found++;
+        }
+    }
+    uint32_t miss_us = ztimer_now(ZTIMER_USEC) - start;
+
+    for (unsigned i = 0; i < count; i++) {
+        _route_dst(&dst, i);
+        gnrc_ipv6_nib_ft_del(&dst, IPV6_ADDR_BIT_LEN);
+    }
+
+    if (found != TEST_REPS) {
+        printf("error: found %u of %u routes\n", found, TEST_REPS);
+    }
+    printf("{ \"routes\" : %u, \"lookup_ns\" : %" PRIu32 ", "
+           "\"miss_ns\" : %" PRIu32 " }\n", count,
+           (uint32_t)(((uint64_t)lookup_us * NS_PER_US) / TEST_REPS),
+           (uint32_t)(((uint64_t)miss_us * NS_PER_US) / TEST_REPS));
+}
+
+int main(void)
+{
+    gnrc_ipv6_nib_init();
+
+    for (unsigned count = 1; count <= TEST_MAX_ROUTES; count *= 2) {
+        _bench(count);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure neighbor cache operations with a growing number of
+ *              neighbors
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/ipv6/addr.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define TEST_MAX_NEIGHBORS      CONFIG_GNRC_IPV6_NIB_NUMOF
+#define TEST_MIN_NEIGHBORS      (16U)
+
+/* number of resolutions measured per neighbor count */
+#ifndef TEST_REPS
+#define TEST_REPS               (1024U)
+#endif
+
+static const uint8_t _dev_addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _main_msg_queue[2];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_dev_addr));
+    memcpy(value, _dev_addr, sizeof(_dev_addr));
+    return sizeof(_dev_addr);
+}
+
+/* neighbor fe80::<n + 1> with link-layer address 02:00:00:00:<n + 1> */
+static void _neighbor(ipv6_addr_t *addr, uint8_t *l2addr, unsigned n)
+{
+    ipv6_addr_from_str(addr, "fe80::");
+    addr->u16[7] = byteorder_htons(n + 1);
+    memset(l2addr, 0, ETHERNET_ADDR_LEN);
+    l2addr[0] = 0x02;
+    l2addr[4] = (uint8_t)((n + 1) >> 8);
+    l2addr[5] = (uint8_t)(n + 1);
+}
+
+static void _bench(unsigned count)
+{
+    gnrc_ipv6_nib_nc_t nce;
+    ipv6_addr_t addr;
+    uint8_t l2addr[ETHERNET_ADDR_LEN];
+    unsigned found = 0;
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < count; i++) {
+        _neighbor(&addr, l2addr, i);
+        if (gnrc_ipv6_nib_nc_set(&addr, _netif.pid, l2addr,
+                                 sizeof(l2addr)) < 0) {
+            printf("error: unable to add neighbor %u\n", i);
+            return;
+        }
+    }
+    uint32_t add_us = ztimer_now(ZTIMER_USEC) - start;
+
+    /* resolve each neighbor in turn */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        _neighbor(&addr, l2addr, i % count);
+        if (gnrc_ipv6_nib_get_next_hop_l2addr(&addr, &_netif, NULL,
+                                              &nce) == 0) {
+            found++;
+        }
+    }
+    uint32_t resolve_us = ztimer_now(ZTIMER_USEC) - start;
+
+    for (unsigned i = 0; i < count; i++) {
+        _neighbor(&addr, l2addr, i);
+        gnrc_ipv6_nib_nc_del(&addr, _netif.pid);
+    }
+
+    if (found != TEST_REPS) {
+        printf("error: resolved %u of %u neighbors\n", found, TEST_REPS);
+    }
+    printf("{ \"neighbors\" : %u, \"add_ns\" : %" PRIu32 ", "
+           "\"resolve_ns\" : %" PRIu32 " }\n", count,
+           (uint32_t)(((uint64_t)add_us * NS_PER_US) / count),
+           (uint32_t)(((uint64_t)resolve_us * NS_PER_US) / TEST_REPS));
+}
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, ARRAY_SIZE(_main_msg_queue));
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_address);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "netdev_test", &_dev.netdev) == 0);
+
+    for (unsigned count = TEST_MIN_NEIGHBORS; count <= TEST_MAX_NEIGHBORS;
+         count *= 2) {
+        _bench(count);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 OTA keys S.A.
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    while True:
+        res = child.expect([r"{ \"neighbors\" : \d+, \"add_ns\" : \d+, "
+                            r"\"resolve_ns\" : \d+ }", "DONE"])
+        if res == 1:
+            break
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the cost of sending unicast packets through the IPv6
+ *              thread with a growing number of neighbors
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "msg.h"
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/ipv6/addr.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define TEST_MAX_NEIGHBORS      CONFIG_GNRC_IPV6_NIB_NUMOF
+#define TEST_MIN_NEIGHBORS      (16U)
+
+/* number of packets measured per neighbor count */
+#ifndef TEST_REPS
+#define TEST_REPS               (1024U)
+#endif
+
+#define TEST_PAYLOAD_LEN        (8U)
+
+static const uint8_t _dev_addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+static const ipv6_addr_t _own_addr = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff, 0xff, 0xff
+    }
+};
+
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _main_msg_queue[2];
+static mutex_t _sent = MUTEX_INIT_LOCKED;
+static unsigned _sent_count;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_dev_addr));
+    memcpy(value, _dev_addr, sizeof(_dev_addr));
+    return sizeof(_dev_addr);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    const ethernet_hdr_t *hdr = iolist->iol_base;
+
+    (void)dev;
+    if (hdr->dst[0] != 0x02) {
+        /* ignore neighbor discovery and MLD on multicast addresses */
+        return iolist_size(iolist);
+    }
+    _sent_count++;
+    mutex_unlock(&_sent);
+    return iolist_size(iolist);
+}
+
+/* neighbor 2001:db8::<n + 1> with link-layer address 02:00:00:00:<n + 1>,
+ * so packets to any neighbor are the only ones with 0x02 as first octet of the
+ * destination */
+static void _neighbor(ipv6_addr_t *addr, uint8_t *l2addr, unsigned n)
+{
+    ipv6_addr_from_str(addr, "2001:db8::");
+    addr->u16[7] = byteorder_htons(n + 1);
+    memset(l2addr, 0, ETHERNET_ADDR_LEN);
+    l2addr[0] = 0x02;
+    l2addr[4] = (uint8_t)((n + 1) >> 8);
+    l2addr[5] = (uint8_t)(n + 1);
+}
+
+static bool _send_to(const ipv6_addr_t *dst)
+{
+    static const uint8_t payload[TEST_PAYLOAD_LEN] = { 0 };
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, payload, sizeof(payload),
+                                          GNRC_NETTYPE_UNDEF);
+
+    if ((pkt == NULL) ||
+        ((pkt = gnrc_ipv6_hdr_build(pkt, NULL, dst)) == NULL)) {
+        puts("error: unable to allocate packet");
+        return false;
+    }
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_IPV6,
+                                   GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        puts("error: no IPv6 thread");
+        gnrc_pktbuf_release(pkt);
+        return false;
+    }
+    /* wait for the packet to leave the interface */
+    mutex_lock(&_sent);
+    return true;
+}
+
+static void _bench(unsigned count)
+{
+    ipv6_addr_t addr;
+    uint8_t l2addr[ETHERNET_ADDR_LEN];
+
+    for (unsigned i = 0; i < count; i++) {
+        _neighbor(&addr, l2addr, i);
+        if (gnrc_ipv6_nib_nc_set(&addr, _netif.pid, l2addr,
+                                 sizeof(l2addr)) < 0) {
+            printf("error: unable to add neighbor %u\n", i);
+            return;
+        }
+    }
+
+    /* one flow to the neighbor added last */
+    _sent_count = 0;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        if (!_send_to(&addr)) {
+            return;
+        }
+    }
+    uint32_t send_us = ztimer_now(ZTIMER_USEC) - start;
+
+    for (unsigned i = 0; i < count; i++) {
+        _neighbor(&addr, l2addr, i);
+        gnrc_ipv6_nib_nc_del(&addr, _netif.pid);
+    }
+
+    if (_sent_count != TEST_REPS) {
+        printf("error: sent %u of %u packets\n", _sent_count, TEST_REPS);
+    }
+    printf("{ \"neighbors\" : %u, \"send_ns\" : %" PRIu32 " }\n", count,
+           (uint32_t)(((uint64_t)send_us * NS_PER_US) / TEST_REPS));
+}
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, ARRAY_SIZE(_main_msg_queue));
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_dev, _send);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "netdev_test", &_dev.netdev) == 0);
+    /* valid right away, so source address selection does not need to wait
+     * for duplicate address detection */
+    expect(gnrc_netif_ipv6_addr_add_internal(
+                &_netif, &_own_addr, 64,
+                GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID
+            ) >= 0);
+
+    for (unsigned count = TEST_MIN_NEIGHBORS; count <= TEST_MAX_NEIGHBORS;
+         count *= 2) {
+        _bench(count);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure source address selection with a growing number of
+ *              addresses on the interface
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/ipv6/addr.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* number of selections measured per address count */
+#ifndef TEST_REPS
+#define TEST_REPS               (4096U)
+#endif
+
+static const uint8_t _dev_addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _main_msg_queue[2];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_dev_addr));
+    memcpy(value, _dev_addr, sizeof(_dev_addr));
+    return sizeof(_dev_addr);
+}
+
+/* address 2001:db8:0:<n>::1, so all addresses have the same scope and
+ * selection has to compare the prefixes of all of them */
+static void _global_addr(ipv6_addr_t *addr, unsigned n)
+{
+    ipv6_addr_from_str(addr, "2001:db8::1");
+    addr->u16[3] = byteorder_htons(n);
+}
+
+static unsigned _addrs_numof(void)
+{
+    unsigned res = 0;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
+        if (_netif.ipv6.addrs_flags[i] != 0) {
+            res++;
+        }
+    }
+    return res;
+}
+
+static void _bench(unsigned count, const ipv6_addr_t *dst)
+{
+    unsigned found = 0;
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        if (gnrc_netif_ipv6_addr_best_src(&_netif, dst, false) != NULL) {
+            found++;
+        }
+    }
+    uint32_t best_src_us = ztimer_now(ZTIMER_USEC) - start;
+
+    if (found != TEST_REPS) {
+        printf("error: found %u of %u source addresses\n", found, TEST_REPS);
+    }
+    printf("{ \"addrs\" : %u, \"best_src_ns\" : %" PRIu32 " }\n", count,
+           (uint32_t)(((uint64_t)best_src_us * NS_PER_US) / TEST_REPS));
+}
+
+int main(void)
+{
+    ipv6_addr_t addr;
+
+    msg_init_queue(_main_msg_queue, ARRAY_SIZE(_main_msg_queue));
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_address);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "netdev_test", &_dev.netdev) == 0);
+
+    /* the interface might already have its link-local address */
+    for (unsigned n = 1; _addrs_numof() < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF;
+         n++) {
+        _global_addr(&addr, n);
+        if (gnrc_netif_ipv6_addr_add_internal(
+                    &_netif, &addr, 64, GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID
+                ) < 0) {
+            printf("error: unable to add address %u\n", n);
+            return 1;
+        }
+        /* destination matching the address added last best */
+        addr.u8[15] = 2;
+        _bench(_addrs_numof(), &addr);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
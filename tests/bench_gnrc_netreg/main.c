@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure lookups in the GNRC network protocol registry
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/gnrc/netreg.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef TEST_MAX_ENTRIES
+#define TEST_MAX_ENTRIES        (256U)
+#endif
+
+/* number of lookups measured per entry count */
+#ifndef TEST_REPS
+#define TEST_REPS               (1024U)
+#endif
+
+/* registered entries are demultiplexed by port, like UDP sockets */
+#define TEST_PORT               (1024U)
+
+static gnrc_netreg_entry_t _entries[TEST_MAX_ENTRIES];
+static msg_t _main_msg_queue[4];
+
+static void _bench(unsigned count)
+{
+    unsigned found = 0;
+
+    for (unsigned i = 0; i < count; i++) {
+        gnrc_netreg_entry_init_pid(&_entries[i], TEST_PORT + i,
+                                   thread_getpid());
+        gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &_entries[i]);
+    }
+
+    /* look up each registered port in turn */
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        if (gnrc_netreg_lookup(GNRC_NETTYPE_UNDEF,
+                               TEST_PORT + (i % count)) != NULL) {
+            found++;
+        }
+    }
+    uint32_t lookup_us = ztimer_now(ZTIMER_USEC) - start;
+
+    /* look up a port nobody registered for */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        if (gnrc_netreg_lookup(GNRC_NETTYPE_UNDEF, TEST_PORT - 1) != NULL) {
+            found++;
+        }
+    }
+    uint32_t miss_us = ztimer_now(ZTIMER_USEC) - start;
+
+    for (unsigned i = 0; i < count; i++) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_UNDEF, &_entries[i]);
+    }
+
+    if (found != TEST_REPS) {
+        printf("error: found %u of %u entries\n", found, TEST_REPS);
+    }
+    printf("{ \"entries\" : %u, \"lookup_ns\" : %" PRIu32 ", "
+           "\"miss_ns\" : %" PRIu32 " }\n", count,
+           (uint32_t)(((uint64_t)lookup_us * NS_PER_US) / TEST_REPS),
+           (uint32_t)(((uint64_t)miss_us * NS_PER_US) / TEST_REPS));
+}
+
+int main(void)
+{
+    /* gnrc_netreg_register() expects the registering thread to have a
+     * message queue */
+    msg_init_queue(_main_msg_queue, ARRAY_SIZE(_main_msg_queue));
+    gnrc_netreg_init();
+
+    for (unsigned count = 1; count <= TEST_MAX_ENTRIES; count *= 2) {
+        _bench(count);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure packet buffer throughput and fragmentation with frames
+ *              received via netdev_test
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "random.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1U * US_PER_SEC)
+#endif
+
+/* range of the length of received frames, including the Ethernet header */
+#ifndef TEST_MIN_FRAME
+#define TEST_MIN_FRAME      (sizeof(ethernet_hdr_t) + 46U)
+#endif
+
+#ifndef TEST_MAX_FRAME
+#define TEST_MAX_FRAME      (600U)
+#endif
+
+/* number of received packets kept in the packet buffer */
+#ifndef TEST_HELD
+#define TEST_HELD           (6U)
+#endif
+
+#define _MAC_STACKSIZE      (THREAD_STACKSIZE_DEFAULT)
+#define _MAC_PRIO           (THREAD_PRIORITY_MAIN - 1)
+#define _MAIN_QUEUE_SIZE    (4U)
+
+static const uint8_t _dev_addr[] = { 0x6c, 0x5d, 0xff, 0x73, 0x84, 0x6f };
+static const uint8_t _src_addr[] = { 0x41, 0x9b, 0x9f, 0x56, 0x36, 0x46 };
+
+static gnrc_netif_t _netif;
+static char _mac_stack[_MAC_STACKSIZE];
+static netdev_test_t _dev;
+static msg_t _main_msg_queue[_MAIN_QUEUE_SIZE];
+static gnrc_pktsnip_t *_held[TEST_HELD];
+static unsigned _frame_len;
+
+static void _dev_isr(netdev_t *dev)
+{
+    if (dev->event_callback) {
+        dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+    }
+}
+
+static int _dev_recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return _frame_len;
+    }
+    else if (len < (int)_frame_len) {
+        return -ENOBUFS;
+    }
+    else {
+        ethernet_hdr_t *hdr = (ethernet_hdr_t *)buf;
+
+        memcpy(hdr->dst, _dev_addr, sizeof(_dev_addr));
+        memcpy(hdr->src, _src_addr, sizeof(_src_addr));
+        /* no gnrc_ipv6 in compile unit => ETHERTYPE_IPV6 translates to
+         * GNRC_NETTYPE_UNDEF */
+        hdr->type = byteorder_htons(ETHERTYPE_IPV6);
+        return _frame_len;
+    }
+}
+
+static int _dev_get_addr(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    if (max_len < sizeof(_dev_addr)) {
+        return -ENOBUFS;
+    }
+    memcpy(value, _dev_addr, sizeof(_dev_addr));
+    return sizeof(_dev_addr);
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t me = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                        thread_getpid());
+    uint32_t frames = 0;
+    uint32_t dropped = 0;
+
+    gnrc_pktbuf_init();
+    msg_init_queue(_main_msg_queue, _MAIN_QUEUE_SIZE);
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_isr_cb(&_dev, _dev_isr);
+    netdev_test_set_recv_cb(&_dev, _dev_recv);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _dev_get_addr);
+    gnrc_netif_ethernet_create(&_netif, _mac_stack, _MAC_STACKSIZE, _MAC_PRIO,
+                               "netdev_test", (netdev_t *)&_dev);
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &me);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    while ((ztimer_now(ZTIMER_USEC) - start) < TEST_DURATION) {
+        msg_t msg;
+
+        _frame_len = random_uint32_range(TEST_MIN_FRAME, TEST_MAX_FRAME + 1);
+        /* the interface's thread has a higher priority, so the frame is
+         * handled before this returns */
+        netdev_trigger_event_isr((netdev_t *)&_dev.netdev);
+        frames++;
+        if (msg_try_receive(&msg) < 0) {
+            dropped++;
+            continue;
+        }
+        if (msg.type != GNRC_NETAPI_MSG_TYPE_RCV) {
+            continue;
+        }
+
+        unsigned idx = random_uint32_range(0, TEST_HELD);
+        if (_held[idx] != NULL) {
+            gnrc_pktbuf_release(_held[idx]);
+        }
+        _held[idx] = msg.content.ptr;
+    }
+    uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"frames_per_sec\" : %" PRIu32 ", \"dropped\" : %" PRIu32 " }\n",
+           (uint32_t)(((uint64_t)frames * US_PER_SEC) / duration), dropped);
+
+    for (unsigned i = 0; i < TEST_HELD; i++) {
+        gnrc_pktbuf_release(_held[i]);
+    }
+    gnrc_netreg_unregister(GNRC_NETTYPE_UNDEF, &me);
+
+    puts("DONE");
+
+    return 0;
+}
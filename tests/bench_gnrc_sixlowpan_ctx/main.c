@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the context lookup for and the IPHC compression of
+ *              outgoing datagrams with a growing number of contexts
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "iolist.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/ipv6/addr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* number of lookups and datagrams compressed per number of contexts */
+#ifndef TEST_REPS
+#define TEST_REPS               (1024U)
+#endif
+
+#define TEST_PAYLOAD_SIZE       (32U)
+/* context of the addresses of the datagram, all others are more specific
+ * and do not match them */
+#define TEST_PREFIX     { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }
+#define TEST_PREFIX_LEN (48U)
+#define TEST_OTHER_PREFIX_LEN   (64U)
+#define TEST_SRC_ADDR   { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                          0x28, 0xab, 0xdc, 0x15, 0x54, 0x01, 0x64, 0x79 }
+#define TEST_DST_ADDR   { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                          0x58, 0x9d, 0x93, 0x86, 0x22, 0x08, 0x65, 0x79 }
+#define TEST_DST        { 0x5a, 0x9d, 0x93, 0x86, 0x22, 0x08, 0x65, 0x79 }
+#define TEST_SRC        { 0x2a, 0xab, 0xdc, 0x15, 0x54, 0x01, 0x64, 0x79 }
+
+static const uint8_t _test_src[] = TEST_SRC;
+static const uint8_t _test_dst[] = TEST_DST;
+static const ipv6_addr_t _test_prefix = { .u8 = TEST_PREFIX };
+static const ipv6_addr_t _test_src_addr = { .u8 = TEST_SRC_ADDR };
+static const ipv6_addr_t _test_dst_addr = { .u8 = TEST_DST_ADDR };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static unsigned _sent;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = 102U;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_test_src);
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_test_src));
+    memcpy(value, _test_src, sizeof(_test_src));
+    return sizeof(_test_src);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    /* first entry is the MAC header */
+    uint8_t *iphc_hdr = iolist->iol_next->iol_base;
+
+    (void)dev;
+    /* both addresses were compressed with a context */
+    if (sixlowpan_iphc_is(iphc_hdr) &&
+        (iphc_hdr[1] & SIXLOWPAN_IPHC2_SAC) &&
+        (iphc_hdr[1] & SIXLOWPAN_IPHC2_DAC)) {
+        _sent++;
+    }
+    return iolist_size(iolist);
+}
+
+static gnrc_pktsnip_t *_build(void)
+{
+    gnrc_pktsnip_t *netif, *ipv6, *payload;
+    ipv6_hdr_t *hdr;
+
+    payload = gnrc_pktbuf_add(NULL, NULL, TEST_PAYLOAD_SIZE,
+                              GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        return NULL;
+    }
+    ipv6 = gnrc_ipv6_hdr_build(payload, &_test_src_addr, &_test_dst_addr);
+    if (ipv6 == NULL) {
+        gnrc_pktbuf_release(payload);
+        return NULL;
+    }
+    hdr = ipv6->data;
+    hdr->len = byteorder_htons(TEST_PAYLOAD_SIZE);
+    hdr->nh = PROTNUM_IPV6_NONXT;
+    hdr->hl = 64U;
+    netif = gnrc_netif_hdr_build(NULL, 0, _test_dst, sizeof(_test_dst));
+    if (netif == NULL) {
+        gnrc_pktbuf_release(ipv6);
+        return NULL;
+    }
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    return gnrc_pkt_prepend(ipv6, netif);
+}
+
+static void _add_contexts(unsigned contexts)
+{
+    /* context 0 is always TEST_PREFIX */
+    for (unsigned id = 1; id < contexts; id++) {
+        ipv6_addr_t prefix = _test_prefix;
+
+        /* 2001:db8:0:<id>::/64 */
+        prefix.u8[7] = id;
+        expect(gnrc_sixlowpan_ctx_update(id, &prefix, TEST_OTHER_PREFIX_LEN,
+                                         UINT16_MAX, true) != NULL);
+    }
+}
+
+static void _bench(unsigned contexts)
+{
+    unsigned found = 0;
+
+    _add_contexts(contexts);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        if (gnrc_sixlowpan_ctx_lookup_addr(&_test_src_addr) != NULL) {
+            found++;
+        }
+    }
+    uint32_t lookup_us = ztimer_now(ZTIMER_USEC) - start;
+
+    /* cost of building the datagram to separate it from the compression */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        gnrc_pktbuf_release(_build());
+    }
+    uint32_t build_us = ztimer_now(ZTIMER_USEC) - start;
+
+    _sent = 0;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        gnrc_pktsnip_t *pkt = _build();
+
+        if (pkt == NULL) {
+            puts("error: unable to allocate datagram");
+            return;
+        }
+        /* the interface has a higher priority, so the frame is sent before
+         * this returns */
+        gnrc_sixlowpan_iphc_send(pkt, NULL, 0);
+    }
+    uint32_t send_us = ztimer_now(ZTIMER_USEC) - start;
+
+    if (found != TEST_REPS) {
+        printf("error: found context for %u of %u addresses\n", found,
+               TEST_REPS);
+    }
+    if (_sent != TEST_REPS) {
+        printf("error: compressed %u of %u datagrams with context\n", _sent,
+               TEST_REPS);
+    }
+    printf("{ \"contexts\" : %u, \"lookup_ns\" : %" PRIu32 ", "
+           "\"build_ns\" : %" PRIu32 ", \"send_ns\" : %" PRIu32 " }\n",
+           contexts, (uint32_t)(((uint64_t)lookup_us * NS_PER_US) / TEST_REPS),
+           (uint32_t)(((uint64_t)build_us * NS_PER_US) / TEST_REPS),
+           (uint32_t)(((uint64_t)send_us * NS_PER_US) / TEST_REPS));
+}
+
+int main(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_address_long);
+    netdev_test_set_send_cb(&_dev, _send);
+    expect(gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                        sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                        "netdev_test",
+                                        &_dev.netdev.netdev) == 0);
+    expect(gnrc_sixlowpan_ctx_update(0, &_test_prefix, TEST_PREFIX_LEN,
+                                     UINT16_MAX, true) != NULL);
+
+    for (unsigned contexts = 1; contexts <= GNRC_SIXLOWPAN_CTX_SIZE;
+         contexts *= 2) {
+        _bench(contexts);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure forwarding of subsequent fragments of a datagram with
+ *              minimal fragment forwarding
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "iolist.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#include "net/netdev_test.h"
+#include "net/sixlowpan.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* number of datagrams forwarded per fragment size */
+#ifndef TEST_REPS
+#define TEST_REPS               (64U)
+#endif
+
+/* divisible by all of _frag_sizes */
+#define TEST_DATAGRAM_SIZE      (1152U)
+#define TEST_DST        { 0x5a, 0x9d, 0x93, 0x86, 0x22, 0x08, 0x65, 0x79 }
+#define TEST_SRC        { 0x2a, 0xab, 0xdc, 0x15, 0x54, 0x01, 0x64, 0x79 }
+#define TEST_NEXT_HOP   { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22, 0xfd, 0x0a }
+
+static const uint8_t _test_src[] = TEST_SRC;
+static const uint8_t _test_dst[] = TEST_DST;
+static const uint8_t _test_next_hop[] = TEST_NEXT_HOP;
+/* bytes of the datagram per fragment, must be multiples of 8 */
+static const unsigned _frag_sizes[] = { 32U, 64U, 96U };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static uint16_t _out_tag;
+static const void *_last_frag;
+static unsigned _sent;
+static unsigned _in_place;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = 102U;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_test_dst);
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_test_dst));
+    memcpy(value, _test_dst, sizeof(_test_dst));
+    return sizeof(_test_dst);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    /* first entry is the MAC header */
+    const iolist_t *frag = iolist->iol_next;
+    sixlowpan_frag_n_t *hdr = frag->iol_base;
+
+    (void)dev;
+    if (sixlowpan_frag_n_is((sixlowpan_frag_t *)hdr) &&
+        (byteorder_ntohs(hdr->tag) == _out_tag)) {
+        _sent++;
+    }
+    /* the fragment was sent from the packet buffer it was received in */
+    if (frag->iol_base == _last_frag) {
+        _in_place++;
+    }
+    return iolist_size(iolist);
+}
+
+static gnrc_pktsnip_t *_build(uint16_t tag, unsigned offset, unsigned size)
+{
+    gnrc_pktsnip_t *pkt = gnrc_netif_hdr_build(_test_src, sizeof(_test_src),
+                                               _test_dst, sizeof(_test_dst));
+    sixlowpan_frag_n_t *hdr;
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    gnrc_netif_hdr_set_netif(pkt->data, &_netif);
+    pkt = gnrc_pktbuf_add(pkt, NULL, sizeof(*hdr) + size,
+                          GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        return NULL;
+    }
+    hdr = pkt->data;
+    hdr->disp_size = byteorder_htons(TEST_DATAGRAM_SIZE);
+    hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+    hdr->tag = byteorder_htons(tag);
+    hdr->offset = offset / 8;
+    memset(hdr + 1, offset / 8, size);
+    return pkt;
+}
+
+static gnrc_sixlowpan_frag_vrb_t *_add_vrbe(uint16_t tag, unsigned frag_size)
+{
+    gnrc_sixlowpan_frag_rb_base_t base = {
+        .src = TEST_SRC,
+        .src_len = sizeof(_test_src),
+        .tag = tag,
+        .datagram_size = TEST_DATAGRAM_SIZE,
+        /* the first fragment was already forwarded */
+        .current_size = frag_size,
+    };
+
+    return gnrc_sixlowpan_frag_vrb_add(&base, &_netif, _test_next_hop,
+                                       sizeof(_test_next_hop));
+}
+
+static void _bench(unsigned frag_size)
+{
+    static uint16_t tag;
+    unsigned frags = TEST_REPS * ((TEST_DATAGRAM_SIZE / frag_size) - 1);
+
+    /* cost of building the received fragments to separate it from the
+     * forwarding */
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        for (unsigned offset = frag_size; offset < TEST_DATAGRAM_SIZE;
+             offset += frag_size) {
+            gnrc_pktbuf_release(_build(tag, offset, frag_size));
+        }
+    }
+    uint32_t build_us = ztimer_now(ZTIMER_USEC) - start;
+
+    _sent = 0;
+    _in_place = 0;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        gnrc_sixlowpan_frag_vrb_t *vrbe = _add_vrbe(tag, frag_size);
+
+        if (vrbe == NULL) {
+            puts("error: unable to create VRB entry");
+            return;
+        }
+        _out_tag = vrbe->out_tag;
+        for (unsigned offset = frag_size; offset < TEST_DATAGRAM_SIZE;
+             offset += frag_size) {
+            gnrc_pktsnip_t *pkt = _build(tag, offset, frag_size);
+
+            if (pkt == NULL) {
+                puts("error: unable to allocate fragment");
+                return;
+            }
+            _last_frag = pkt->data;
+            /* the interface has a higher priority, so the fragment is sent
+             * before this returns */
+            gnrc_sixlowpan_frag_recv(pkt, NULL, 0);
+        }
+        /* entry is removed when the datagram was forwarded completely */
+        if (gnrc_sixlowpan_frag_vrb_get(_test_src, sizeof(_test_src),
+                                        tag) != NULL) {
+            puts("error: VRB entry still exists");
+        }
+        tag++;
+    }
+    uint32_t fwd_us = ztimer_now(ZTIMER_USEC) - start;
+
+    if (_sent != frags) {
+        printf("error: forwarded %u of %u fragments\n", _sent, frags);
+    }
+    printf("{ \"frag_size\" : %u, \"build_ns\" : %" PRIu32 ", "
+           "\"fwd_ns\" : %" PRIu32 ", \"in_place\" : %u }\n", frag_size,
+           (uint32_t)(((uint64_t)build_us * NS_PER_US) / frags),
+           (uint32_t)(((uint64_t)fwd_us * NS_PER_US) / frags), _in_place);
+}
+
+int main(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_address_long);
+    netdev_test_set_send_cb(&_dev, _send);
+    expect(gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                        sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                        "netdev_test",
+                                        &_dev.netdev.netdev) == 0);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_frag_sizes); i++) {
+        _bench(_frag_sizes[i]);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the reassembly of fragmented datagrams with a growing
+ *              number of senders sending at the same time
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "msg.h"
+#include "net/gnrc.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/ieee802154.h"
+#include "net/sixlowpan.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* number of datagrams reassembled per sender */
+#ifndef TEST_REPS
+#define TEST_REPS               (64U)
+#endif
+
+#define TEST_DATAGRAM_SIZE      (320U)
+/* bytes of the datagram per fragment, must be a multiple of 8 */
+#define TEST_FRAG_SIZE          (80U)
+#define TEST_FRAGS_NUMOF        ((TEST_DATAGRAM_SIZE + TEST_FRAG_SIZE - 1) / \
+                                 TEST_FRAG_SIZE)
+
+static const uint8_t _dst[] = { 0x5a, 0x9d, 0x93, 0x86, 0x22, 0x08, 0x65, 0x79 };
+
+static msg_t _main_msg_queue[4];
+
+static gnrc_pktsnip_t *_build(unsigned sender, uint16_t tag, unsigned frag)
+{
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN] = { 0x02 };
+    unsigned offset = frag * TEST_FRAG_SIZE;
+    size_t size = TEST_DATAGRAM_SIZE - offset;
+    gnrc_pktsnip_t *pkt;
+    uint8_t *data;
+
+    src[IEEE802154_LONG_ADDRESS_LEN - 1] = sender;
+    if (size > TEST_FRAG_SIZE) {
+        size = TEST_FRAG_SIZE;
+    }
+    pkt = gnrc_netif_hdr_build(src, sizeof(src), _dst, sizeof(_dst));
+    if (pkt == NULL) {
+        return NULL;
+    }
+    if (frag == 0) {
+        sixlowpan_frag_t *hdr;
+
+        /* first fragment also carries the uncompressed IPv6 dispatch */
+        pkt = gnrc_pktbuf_add(pkt, NULL, sizeof(*hdr) + 1 + size,
+                              GNRC_NETTYPE_SIXLOWPAN);
+        if (pkt == NULL) {
+            return NULL;
+        }
+        hdr = pkt->data;
+        hdr->disp_size = byteorder_htons(TEST_DATAGRAM_SIZE);
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+        hdr->tag = byteorder_htons(tag);
+        data = (uint8_t *)(hdr + 1);
+        *(data++) = SIXLOWPAN_UNCOMP;
+    }
+    else {
+        sixlowpan_frag_n_t *hdr;
+
+        pkt = gnrc_pktbuf_add(pkt, NULL, sizeof(*hdr) + size,
+                              GNRC_NETTYPE_SIXLOWPAN);
+        if (pkt == NULL) {
+            return NULL;
+        }
+        hdr = pkt->data;
+        hdr->disp_size = byteorder_htons(TEST_DATAGRAM_SIZE);
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        hdr->tag = byteorder_htons(tag);
+        hdr->offset = offset / 8;
+        data = (uint8_t *)(hdr + 1);
+    }
+    memset(data, frag, size);
+    return pkt;
+}
+
+static bool _recv_datagram(void)
+{
+    msg_t msg;
+
+    /* skip garbage collection of the reassembly buffer, it is done with
+     * every fragment anyway */
+    do {
+        msg_receive(&msg);
+    } while (msg.type != GNRC_NETAPI_MSG_TYPE_RCV);
+
+    gnrc_pktsnip_t *pkt = msg.content.ptr;
+    bool res = (pkt->size == TEST_DATAGRAM_SIZE);
+
+    gnrc_pktbuf_release(pkt);
+    return res;
+}
+
+static void _bench(unsigned senders)
+{
+    static uint16_t tag;
+    unsigned frags = TEST_REPS * senders * TEST_FRAGS_NUMOF;
+    unsigned datagrams = 0;
+
+    /* cost of building the received fragments to separate it from the
+     * reassembly */
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS * TEST_FRAGS_NUMOF; i++) {
+        for (unsigned s = 0; s < senders; s++) {
+            gnrc_pktbuf_release(_build(s, tag, i % TEST_FRAGS_NUMOF));
+        }
+    }
+    uint32_t build_us = ztimer_now(ZTIMER_USEC) - start;
+
+    /* all senders send their datagram at the same time, so their fragments
+     * arrive interleaved */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        for (unsigned f = 0; f < TEST_FRAGS_NUMOF; f++) {
+            for (unsigned s = 0; s < senders; s++) {
+                gnrc_pktsnip_t *pkt = _build(s, tag, f);
+
+                if (pkt == NULL) {
+                    puts("error: unable to allocate fragment");
+                    return;
+                }
+                gnrc_sixlowpan_frag_recv(pkt, NULL, 0);
+                if ((f == (TEST_FRAGS_NUMOF - 1)) && _recv_datagram()) {
+                    datagrams++;
+                }
+            }
+        }
+        tag++;
+    }
+    uint32_t recv_us = ztimer_now(ZTIMER_USEC) - start;
+
+    if (datagrams != (TEST_REPS * senders)) {
+        printf("error: reassembled %u of %u datagrams\n", datagrams,
+               TEST_REPS * senders);
+    }
+    printf("{ \"senders\" : %u, \"build_ns\" : %" PRIu32 ", "
+           "\"recv_ns\" : %" PRIu32 ", \"frags_per_sec\" : %" PRIu32 " }\n",
+           senders, (uint32_t)(((uint64_t)build_us * NS_PER_US) / frags),
+           (uint32_t)(((uint64_t)recv_us * NS_PER_US) / frags),
+           (uint32_t)(((uint64_t)frags * US_PER_SEC) / recv_us));
+}
+
+int main(void)
+{
+    /* without gnrc_ipv6 the reassembled datagrams are not typed */
+    gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_PID(
+            GNRC_NETREG_DEMUX_CTX_ALL, thread_getpid()
+        );
+
+    msg_init_queue(_main_msg_queue, ARRAY_SIZE(_main_msg_queue));
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &entry);
+
+    for (unsigned senders = 1; senders <= TEST_MAX_SENDERS; senders *= 2) {
+        _bench(senders);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
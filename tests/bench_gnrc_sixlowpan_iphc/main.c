@@ -0,0 +1,315 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the decompression of received 6LoWPAN IPHC frames
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/ipv6/addr.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* number of frames decompressed per frame of the corpus */
+#ifndef TEST_REPS
+#define TEST_REPS               (1024U)
+#endif
+
+#define TEST_PREFIX     { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }
+#define TEST_PREFIX_LEN (64U)
+#define TEST_DST        { 0x5a, 0x9d, 0x93, 0x86, 0x22, 0x08, 0x65, 0x79 }
+#define TEST_SRC        { 0x2a, 0xab, 0xdc, 0x15, 0x54, 0x01, 0x64, 0x79 }
+
+typedef struct {
+    const uint8_t *data;
+    size_t len;
+} test_frame_t;
+
+static const uint8_t _test_src[] = TEST_SRC;
+static const uint8_t _test_dst[] = TEST_DST;
+static const ipv6_addr_t _test_prefix = { .u8 = TEST_PREFIX };
+
+/* ICMPv6 echo request between link-local addresses derived from the link-layer
+ * addresses */
+static const uint8_t _icmpv6_echo[] = {
+    /* IPHC: TF elided, NH inline, HLIM 64, SAM/DAM elided (stateless) */
+    0x7a, 0x33,
+    /* Next header: ICMPv6 */
+    0x3a,
+    /* ICMPv6 echo request: type, code, checksum, identifier, sequence */
+    0x80, 0x00, 0x6d, 0x3b, 0x23, 0x8f, 0x00, 0x02,
+    /* data */
+    0x9d, 0x4b, 0xb2, 0x1c, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+};
+
+/* RPL DIO from a link-local address to ff02::1a */
+static const uint8_t _rpl_dio[] = {
+    /* IPHC: TF elided, NH inline, HLIM 255, SAM elided (stateless),
+     * DAM ff02::00XX */
+    0x7b, 0x3b,
+    /* Next header: ICMPv6 */
+    0x3a,
+    /* Destination: ff02::1a */
+    0x1a,
+    /* ICMPv6 RPL control: type, code (DIO), checksum */
+    0x9b, 0x01, 0x7a, 0x5f,
+    /* DIO base: instance, version, rank, G/MOP/Prf, DTSN, flags, reserved */
+    0x00, 0xf0, 0x01, 0x00, 0x88, 0x00, 0x00, 0x00,
+    /* DODAG ID: 2001:db8::1 */
+    0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    /* DODAG configuration option */
+    0x04, 0x0e, 0x00, 0x08, 0x0c, 0x0a, 0x07, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff,
+};
+
+/* CoAP GET request with context-based global addresses and all UDP ports
+ * inline */
+static const uint8_t _coap_get[] = {
+    /* IPHC: TF elided, NH compressed, HLIM 64, SAM elided (context 0),
+     * DAM 64 bits inline (context 0) */
+    0x7e, 0x75,
+    /* Destination IID */
+    0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01,
+    /* NHC UDP: ports and checksum inline */
+    0xf0,
+    /* Source port: 49153, destination port: 5683, checksum */
+    0xc0, 0x01, 0x16, 0x33, 0x4c, 0x1e,
+    /* CoAP: CON GET, message ID, Uri-Path "sensors", Uri-Path "temp" */
+    0x40, 0x01, 0x12, 0x34,
+    0xb7, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x73,
+    0x04, 0x74, 0x65, 0x6d, 0x70,
+};
+
+/* CoAP response between 16-bit link-local addresses on compressed UDP
+ * ports */
+static const uint8_t _coap_resp[] = {
+    /* IPHC: TF elided, NH compressed, HLIM 64, SAM/DAM 16 bits inline
+     * (stateless) */
+    0x7e, 0x22,
+    /* Source: fe80::ff:fe00:2, destination: fe80::ff:fe00:1 */
+    0x00, 0x02, 0x00, 0x01,
+    /* NHC UDP: 4-bit ports, checksum inline */
+    0xf3,
+    /* Source port: 61617, destination port: 61618, checksum */
+    0x12, 0x9f, 0x41,
+    /* CoAP: ACK 2.05 Content, message ID, token, payload marker */
+    0x61, 0x45, 0x12, 0x34, 0xa7, 0xff,
+    /* payload */
+    0x7b, 0x22, 0x74, 0x65, 0x6d, 0x70, 0x22, 0x3a,
+    0x32, 0x31, 0x2e, 0x35, 0x2c, 0x22, 0x75, 0x6e,
+    0x69, 0x74, 0x22, 0x3a, 0x22, 0x43, 0x65, 0x6c,
+    0x22, 0x7d,
+};
+
+/* UDP datagram with a hop-by-hop RPL option as routed within a RPL
+ * instance */
+static const uint8_t _rpl_udp[] = {
+    /* IPHC: TF elided, NH compressed, HLIM 64, SAM/DAM 16 bits inline
+     * (context 0) */
+    0x7e, 0x66,
+    /* Source: 2001:db8::ff:fe00:3, destination: 2001:db8::ff:fe00:1 */
+    0x00, 0x03, 0x00, 0x01,
+    /* NHC extension header: hop-by-hop options, next header compressed */
+    0xe1,
+    /* length, RPL option: type, length, flags, instance, sender rank */
+    0x06, 0x63, 0x04, 0x00, 0x00, 0x02, 0x00,
+    /* NHC UDP: 4-bit ports, checksum inline */
+    0xf3,
+    /* Source port: 61619, destination port: 61617, checksum */
+    0x31, 0x03, 0x8c,
+    /* payload */
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+};
+
+static const test_frame_t _frames[] = {
+    { _icmpv6_echo, sizeof(_icmpv6_echo) },
+    { _rpl_dio, sizeof(_rpl_dio) },
+    { _coap_get, sizeof(_coap_get) },
+    { _coap_resp, sizeof(_coap_resp) },
+    { _rpl_udp, sizeof(_rpl_udp) },
+};
+
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _main_msg_queue[2];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = 102U;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_test_dst);
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_test_dst));
+    memcpy(value, _test_dst, sizeof(_test_dst));
+    return sizeof(_test_dst);
+}
+
+static gnrc_pktsnip_t *_build(const test_frame_t *frame)
+{
+    gnrc_pktsnip_t *pkt = gnrc_netif_hdr_build(_test_src, sizeof(_test_src),
+                                               _test_dst, sizeof(_test_dst));
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    gnrc_netif_hdr_set_netif(pkt->data, &_netif);
+    pkt = gnrc_pktbuf_add(pkt, frame->data, frame->len,
+                          GNRC_NETTYPE_SIXLOWPAN);
+    return pkt;
+}
+
+static bool _recv(const test_frame_t *frame)
+{
+    gnrc_pktsnip_t *pkt = _build(frame);
+    msg_t msg;
+
+    if (pkt == NULL) {
+        puts("error: unable to allocate packet");
+        return false;
+    }
+    gnrc_sixlowpan_iphc_recv(pkt, NULL, 0);
+    /* decompressed packet is dispatched to this thread, if it was not
+     * dropped */
+    if (msg_try_receive(&msg) < 0) {
+        puts("error: frame was dropped");
+        return false;
+    }
+    pkt = msg.content.ptr;
+    bool res = (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) &&
+               (pkt->type == GNRC_NETTYPE_IPV6);
+    gnrc_pktbuf_release(pkt);
+    return res;
+}
+
+static void _bench(unsigned idx)
+{
+    const test_frame_t *frame = &_frames[idx];
+    unsigned decoded = 0;
+
+    /* cost of building the received frame to separate it from the
+     * decompression */
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        gnrc_pktbuf_release(_build(frame));
+    }
+    uint32_t build_us = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        if (!_recv(frame)) {
+            break;
+        }
+        decoded++;
+    }
+    uint32_t recv_us = ztimer_now(ZTIMER_USEC) - start;
+
+    if (decoded != TEST_REPS) {
+        printf("error: decompressed %u of %u frames\n", decoded, TEST_REPS);
+    }
+    printf("{ \"frame\" : %u, \"len\" : %u, \"build_ns\" : %" PRIu32 ", "
+           "\"recv_ns\" : %" PRIu32 " }\n", idx, (unsigned)frame->len,
+           (uint32_t)(((uint64_t)build_us * NS_PER_US) / TEST_REPS),
+           (uint32_t)(((uint64_t)recv_us * NS_PER_US) / TEST_REPS));
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t ipv6 = GNRC_NETREG_ENTRY_INIT_PID(
+            GNRC_NETREG_DEMUX_CTX_ALL, thread_getpid()
+        );
+    gnrc_netreg_entry_t *entry;
+
+    msg_init_queue(_main_msg_queue, ARRAY_SIZE(_main_msg_queue));
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_address_long);
+    expect(gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                        sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                        "netdev_test",
+                                        &_dev.netdev.netdev) == 0);
+    expect(gnrc_sixlowpan_ctx_update(0, &_test_prefix, TEST_PREFIX_LEN,
+                                     UINT16_MAX, true) != NULL);
+
+    /* take decompressed packets from the IPv6 thread, so only decompression
+     * is measured */
+    while ((entry = gnrc_netreg_lookup(GNRC_NETTYPE_IPV6,
+                                       GNRC_NETREG_DEMUX_CTX_ALL)) != NULL) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_IPV6, entry);
+    }
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &ipv6);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_frames); i++) {
+        _bench(i);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
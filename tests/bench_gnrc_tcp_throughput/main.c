@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the receive throughput of a GNRC TCP connection with
+ *              different receive buffer sizes
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "msg.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define MAIN_QUEUE_SIZE         (8)
+
+/* largest receive buffer a connection is measured with */
+#ifndef TEST_RCV_BUF_SIZE
+#define TEST_RCV_BUF_SIZE       (131072U)
+#endif
+
+/* the peer may not stall the connection for longer than this */
+#ifndef TEST_RECV_TIMEOUT_MS
+#define TEST_RECV_TIMEOUT_MS    (30U * MS_PER_SEC)
+#endif
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+static uint8_t _rcv_buf[TEST_RCV_BUF_SIZE];
+static uint8_t _data[1024];
+
+static int _bench(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+    unsigned rcv_buf_size = TEST_RCV_BUF_SIZE;
+    uint32_t bytes = 0;
+    ssize_t res;
+    int err;
+
+    if ((argc < 2) || (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0)) {
+        printf("usage: %s <[addr%%iface]:port> [<rcv_buf_size>]\n", argv[0]);
+        return 1;
+    }
+    if (argc > 2) {
+        rcv_buf_size = atoi(argv[2]);
+        if ((rcv_buf_size == 0) || (rcv_buf_size > TEST_RCV_BUF_SIZE)) {
+            printf("error: receive buffer size must be 1..%u\n",
+                   TEST_RCV_BUF_SIZE);
+            return 1;
+        }
+    }
+    gnrc_tcp_tcb_init(&_tcb);
+    gnrc_tcp_tcb_set_rcv_buf(&_tcb, _rcv_buf, rcv_buf_size);
+    if ((err = gnrc_tcp_open_active(&_tcb, &remote, 0)) < 0) {
+        printf("error: unable to connect (%d)\n", err);
+        return 1;
+    }
+
+    /* the peer sends until it closes the connection */
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    while ((res = gnrc_tcp_recv(&_tcb, _data, sizeof(_data),
+                                TEST_RECV_TIMEOUT_MS)) > 0) {
+        bytes += res;
+    }
+    uint32_t time_us = ztimer_now(ZTIMER_USEC) - start;
+
+    gnrc_tcp_close(&_tcb);
+    if (res < 0) {
+        printf("error: receive failed after %" PRIu32 " bytes (%d)\n", bytes,
+               (int)res);
+        return 1;
+    }
+    printf("{ \"rcv_buf\" : %u, \"bytes\" : %" PRIu32 ", \"time_us\" : %" PRIu32
+           ", \"kbit_per_sec\" : %" PRIu32 " }\n", rcv_buf_size, bytes, time_us,
+           (uint32_t)(((uint64_t)bytes * 8U * US_PER_MS) / time_us));
+    return 0;
+}
+
+static const shell_command_t _shell_commands[] = {
+    { "bench", "receive from a TCP peer until it closes", _bench },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    /* the shell thread receives the notifications of the TCP connection */
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 OTA keys S.A.
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import re
+import socket
+import subprocess
+import sys
+import threading
+
+from testrunner import run
+
+BENCH_BYTES = 128 * 1024
+# (delay in ms, loss in percent) of the emulated path
+PROFILES = [(0, 0), (50, 0), (50, 1), (200, 2)]
+RCV_BUF_SIZES = [1220, 8192, 65536, 131072]
+
+
+def get_host_tap_device():
+    # Check if given tap device is part of a network bridge
+    # if so use bridged interface instead of given tap device
+    tap = os.environ["TAPDEV"]
+    result = os.popen('bridge link show dev {}'.format(tap))
+    bridge = re.search('master (.*) state', result.read())
+
+    return bridge.group(1).strip() if bridge else tap
+
+
+def get_host_ll_addr(interface):
+    result = os.popen('ip addr show dev ' + interface + ' scope link')
+    return re.search('inet6 (.*)/64', result.read()).group(1).strip()
+
+
+def get_riot_if_id(child):
+    child.sendline('ifconfig')
+    child.expect(r'Iface\s+(\d+)\s')
+    return child.match.group(1).strip()
+
+
+def set_profile(interface, delay_ms, loss_pct):
+    subprocess.check_call(['tc', 'qdisc', 'replace', 'dev', interface, 'root',
+                           'netem', 'delay', '{}ms'.format(delay_ms),
+                           'loss', '{}%'.format(loss_pct)])
+
+
+def clear_profile(interface):
+    subprocess.call(['tc', 'qdisc', 'del', 'dev', interface, 'root'])
+
+
+def tcp_sender(sock):
+    conn, _ = sock.accept()
+    with conn:
+        conn.sendall(bytes(i & 0xff for i in range(BENCH_BYTES)))
+
+
+def testfunc(child):
+    interface = get_host_tap_device()
+    target_addr = get_host_ll_addr(interface) + '%' + get_riot_if_id(child)
+
+    with socket.socket(socket.AF_INET6, socket.SOCK_STREAM) as sock:
+        sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        sock.bind(('::', 0))
+        sock.listen(1)
+        port = sock.getsockname()[1]
+        try:
+            for delay_ms, loss_pct in PROFILES:
+                set_profile(interface, delay_ms, loss_pct)
+                for rcv_buf in RCV_BUF_SIZES:
+                    sender = threading.Thread(target=tcp_sender, args=(sock,))
+                    sender.start()
+                    child.sendline('bench [{}]:{} {}'.format(target_addr, port,
+                                                             rcv_buf))
+                    child.expect(r'{ "rcv_buf" : \d+, "bytes" : (\d+), '
+                                 r'"time_us" : \d+, "kbit_per_sec" : \d+ }')
+                    assert int(child.match.group(1)) == BENCH_BYTES
+                    sender.join()
+                    print('{{ "delay_ms" : {}, "loss_pct" : {}, {}'
+                          .format(delay_ms, loss_pct, child.match.group(0)[2:]))
+        finally:
+            clear_profile(interface)
+    print("DONE")
+
+
+if __name__ == "__main__":
+    if os.geteuid() != 0:
+        print("\x1b[1;31mThis test requires root privileges.\n"
+              "It sets up traffic control on the tap device.\x1b[0m\n",
+              file=sys.stderr)
+        sys.exit(1)
+    sys.exit(run(testfunc, timeout=300, echo=False))
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the throughput of the GNRC receive path with UDP
+ *              packets flooded via netdev_tap
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "net/gnrc.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef TEST_PORT
+#define TEST_PORT           (61616U)
+#endif
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (5U * MS_PER_SEC)
+#endif
+
+#define _MSG_TYPE_DONE      (0x4444)
+#define _MAIN_QUEUE_SIZE    (32U)
+
+static msg_t _main_msg_queue[_MAIN_QUEUE_SIZE];
+
+int main(void)
+{
+    gnrc_netreg_entry_t me = GNRC_NETREG_ENTRY_INIT_PID(TEST_PORT,
+                                                        thread_getpid());
+    msg_t done = { .type = _MSG_TYPE_DONE };
+    ztimer_t timer = { 0 };
+    uint32_t pkts = 0;
+    uint32_t bytes = 0;
+    uint32_t start = 0;
+
+    msg_init_queue(_main_msg_queue, _MAIN_QUEUE_SIZE);
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &me);
+    printf("Listening on UDP port %u\n", TEST_PORT);
+
+    while (1) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        if (msg.type == _MSG_TYPE_DONE) {
+            break;
+        }
+        if (msg.type != GNRC_NETAPI_MSG_TYPE_RCV) {
+            continue;
+        }
+        if (pkts == 0) {
+            start = ztimer_now(ZTIMER_USEC);
+            /* the timer's message is lost while the queue is full, so it only
+             * ends the measurement when the flood stopped early */
+            ztimer_set_msg(ZTIMER_MSEC, &timer, TEST_DURATION, &done,
+                           thread_getpid());
+        }
+        gnrc_pktsnip_t *pkt = msg.content.ptr;
+
+        pkts++;
+        bytes += pkt->size;
+        gnrc_pktbuf_release(pkt);
+        if ((ztimer_now(ZTIMER_USEC) - start) >= (TEST_DURATION * US_PER_MS)) {
+            break;
+        }
+    }
+    ztimer_remove(ZTIMER_MSEC, &timer);
+    uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
+
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &me);
+    printf("{ \"rx_pkts_per_sec\" : %" PRIu32 ", "
+           "\"rx_bytes_per_sec\" : %" PRIu32 " }\n",
+           (uint32_t)(((uint64_t)pkts * US_PER_SEC) / duration),
+           (uint32_t)(((uint64_t)bytes * US_PER_SEC) / duration));
+
+    /* release packets still queued */
+    msg_t msg;
+    while (msg_try_receive(&msg) > 0) {
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    }
+
+    puts("DONE");
+
+    return 0;
+}
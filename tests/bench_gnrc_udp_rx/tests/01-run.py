@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 OTA keys S.A.
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import socket
+import sys
+import time
+
+from testrunner import run
+
+
+TEST_PAYLOAD = int(os.environ.get("TEST_PAYLOAD", 512))
+# send packets in bursts of this size with a pause in between, 0 to flood
+TEST_BURST = int(os.environ.get("TEST_BURST", 0))
+TEST_BURST_PAUSE = 0.001
+# a bit longer than TEST_DURATION of the application
+FLOOD_DURATION = 7
+
+
+def testfunc(child):
+    child.expect(r"Listening on UDP port (\d+)")
+    port = int(child.match.group(1))
+    dst = ("ff02::1", port, 0,
+           socket.if_nametoindex(os.environ.get("TAP", "tap0")))
+    payload = bytes(TEST_PAYLOAD)
+
+    with socket.socket(socket.AF_INET6, socket.SOCK_DGRAM) as sock:
+        stop = time.time() + FLOOD_DURATION
+        sent = 0
+        while time.time() < stop:
+            try:
+                sock.sendto(payload, dst)
+            except OSError:
+                # transmit queue of the TAP interface is full
+                pass
+            sent += 1
+            if TEST_BURST and (sent % TEST_BURST) == 0:
+                time.sleep(TEST_BURST_PAUSE)
+    child.expect(r"{ \"rx_pkts_per_sec\" : (\d+), "
+                 r"\"rx_bytes_per_sec\" : (\d+) }")
+    assert int(child.match.group(1)) > 0
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
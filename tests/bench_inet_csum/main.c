@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the throughput of the Internet checksum for different
+ *              buffer lengths and alignments
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "net/inet_csum.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* number of checksums measured per length and offset */
+#ifndef TEST_REPS
+#define TEST_REPS               (256U)
+#endif
+
+#define TEST_OFFSETS_NUMOF      (4U)
+
+static const uint16_t _lens[] = { 8, 40, 64, 127, 128, 512, 1024, 1280 };
+
+static uint8_t _buf[1280 + TEST_OFFSETS_NUMOF]
+    __attribute__((aligned(sizeof(uint32_t))));
+/* sink for the results, so the calculation is not optimized out */
+static volatile uint16_t _res;
+
+/* the straight-forward implementation of the checksum as comparison */
+static uint16_t _csum_bytewise(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < (len & ~1U); i += 2) {
+        csum += (uint16_t)(buf[i] << 8) + buf[i + 1];
+    }
+    if (len & 1) {
+        csum += (uint16_t)(buf[len - 1] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static uint32_t _ns_per_rep(uint32_t us)
+{
+    return ((uint64_t)us * NS_PER_US) / TEST_REPS;
+}
+
+static void _bench(uint16_t len, unsigned offset)
+{
+    const uint8_t *buf = &_buf[offset];
+
+    if (inet_csum(0, buf, len) != _csum_bytewise(0, buf, len)) {
+        printf("error: checksums for %u bytes at offset %u differ\n",
+               len, offset);
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        _res = inet_csum(0, buf, len);
+    }
+    uint32_t csum_us = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        _res = _csum_bytewise(0, buf, len);
+    }
+    uint32_t bytewise_us = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"len\" : %u, \"offset\" : %u, \"csum_ns\" : %" PRIu32
+           ", \"bytewise_ns\" : %" PRIu32 " }\n", len, offset,
+           _ns_per_rep(csum_us), _ns_per_rep(bytewise_us));
+}
+
+int main(void)
+{
+    /* mostly 0xff, so the sum wraps often */
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = (i % 5) ? 0xff : (uint8_t)i;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        for (unsigned offset = 0; offset < TEST_OFFSETS_NUMOF; offset++) {
+            _bench(_lens[i], offset);
+        }
+    }
+
+    puts("DONE");
+
+    return 0;
+}
@@ -29,9 +29,35 @@
 #define TEST_DURATION       (1000000U)
 #endif
 
+#ifndef TEST_SENDERS_MAX
+#define TEST_SENDERS_MAX    (8U)
+#endif
+
+#ifndef TEST_BATCH_MAX
+#define TEST_BATCH_MAX      (32U)
+#endif
+
+/* the receiver of the scaling test runs below all senders, so that every
+ * sender ends up blocked in the receiver's list of waiting senders */
+#define RECEIVER_PRIO       (THREAD_PRIORITY_IDLE - 1)
+#define SENDER_PRIO_FIRST   (THREAD_PRIORITY_MAIN + 1)
+#define SENDER_PRIO_NUMOF   (RECEIVER_PRIO - SENDER_PRIO_FIRST)
+
 volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
 
+/* the scaling test's threads only loop around msg_receive() or msg_send() */
+static char _receiver_stack[THREAD_STACKSIZE_SMALL];
+static char _sender_stacks[TEST_SENDERS_MAX][THREAD_STACKSIZE_SMALL];
+static kernel_pid_t _receiver_pid;
+static kernel_pid_t _sender_pids[TEST_SENDERS_MAX];
+static volatile uint32_t _received = 0;
+static volatile unsigned _stop = 0;
+
+static char _batch_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _batch_queue[TEST_BATCH_MAX];
+static volatile uint32_t _batch_received = 0;
+
 static void _timer_callback(void*arg)
 {
     (void)arg;
@@ -51,6 +77,126 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void *_receiver_thread(void *arg)
+{
+    (void)arg;
+    msg_t test;
+
+    while(1) {
+        msg_receive(&test);
+        _received++;
+    }
+
+    return NULL;
+}
+
+static void *_sender_thread(void *arg)
+{
+    (void)arg;
+    msg_t test;
+
+    while(1) {
+        while(!_stop) {
+            msg_send(&test, _receiver_pid);
+        }
+        thread_sleep();
+    }
+
+    return NULL;
+}
+
+static void _measure_senders(void)
+{
+    _receiver_pid = thread_create(_receiver_stack,
+                                  sizeof(_receiver_stack),
+                                  RECEIVER_PRIO,
+                                  THREAD_CREATE_STACKTEST,
+                                  _receiver_thread,
+                                  NULL,
+                                  "receiver");
+
+    for (unsigned i = 0; i < TEST_SENDERS_MAX; i++) {
+        _sender_pids[i] = thread_create(_sender_stacks[i],
+                                        sizeof(_sender_stacks[i]),
+                                        SENDER_PRIO_FIRST +
+                                        (i % SENDER_PRIO_NUMOF),
+                                        THREAD_CREATE_SLEEPING |
+                                        THREAD_CREATE_STACKTEST,
+                                        _sender_thread,
+                                        NULL,
+                                        "sender");
+    }
+
+    for (unsigned num = 1; num <= TEST_SENDERS_MAX; num *= 2) {
+        _stop = 0;
+        _received = 0;
+
+        for (unsigned i = 0; i < num; i++) {
+            thread_wakeup(_sender_pids[i]);
+        }
+
+        /* main has the highest priority, senders only run while it sleeps */
+        xtimer_usleep(TEST_DURATION);
+        uint32_t n = _received;
+        _stop = 1;
+
+        /* let all senders drain their pending message and go to sleep */
+        for (unsigned i = 0; i < num; i++) {
+            while (thread_getstatus(_sender_pids[i]) != STATUS_SLEEPING) {
+                xtimer_usleep(US_PER_MS);
+            }
+        }
+
+        printf("{ \"senders\" : %u, \"result\" : %"PRIu32" }\n", num, n);
+    }
+}
+
+static void *_batch_thread(void *arg)
+{
+    (void)arg;
+    msg_t test[TEST_BATCH_MAX];
+
+    msg_init_queue(_batch_queue, TEST_BATCH_MAX);
+
+    while(1) {
+        _batch_received += msg_receive_batch(test, TEST_BATCH_MAX);
+    }
+
+    return NULL;
+}
+
+static void _measure_batches(void)
+{
+    kernel_pid_t other = thread_create(_batch_stack,
+                                       sizeof(_batch_stack),
+                                       (THREAD_PRIORITY_MAIN - 1),
+                                       THREAD_CREATE_STACKTEST,
+                                       _batch_thread,
+                                       NULL,
+                                       "batch_thread");
+
+    xtimer_t timer;
+    timer.callback = _timer_callback;
+
+    msg_t test[TEST_BATCH_MAX];
+
+    for (unsigned batch = 1; batch <= TEST_BATCH_MAX; batch *= 2) {
+        _flag = 0;
+        _batch_received = 0;
+
+        xtimer_set(&timer, TEST_DURATION);
+        while(!_flag) {
+            unsigned sent = 0;
+            while (sent < batch) {
+                sent += msg_send_batch(&test[sent], batch - sent, other);
+            }
+        }
+
+        printf("{ \"batch\" : %u, \"result\" : %"PRIu32" }\n",
+               batch, _batch_received);
+    }
+}
+
 int main(void)
 {
     printf("main starting\n");
@@ -83,5 +229,8 @@ int main(void)
 #endif
     puts(" }");
 
+    _measure_senders();
+    _measure_batches();
+
     return 0;
 }
@@ -10,9 +10,20 @@
 import sys
 from testrunner import run
 
+TEST_SENDERS_MAX = 8
+TEST_BATCH_MAX = 32
+
 
 def testfunc(child):
     child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    num = 1
+    while num <= TEST_SENDERS_MAX:
+        child.expect(r"{ \"senders\" : %d, \"result\" : \d+ }" % num)
+        num *= 2
+    batch = 1
+    while batch <= TEST_BATCH_MAX:
+        child.expect(r"{ \"batch\" : %d, \"result\" : \d+ }" % batch)
+        batch *= 2
 
 
 if __name__ == "__main__":
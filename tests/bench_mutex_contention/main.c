@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure mutex lock throughput under different contention
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION           (1000000U)
+#endif
+
+/* period at which the helper thread contends in the light contention test */
+#ifndef TEST_LIGHT_PERIOD_US
+#define TEST_LIGHT_PERIOD_US    (1000U)
+#endif
+
+/* number of additional threads competing in the heavy contention test */
+#ifndef TEST_HEAVY_THREADS
+#define TEST_HEAVY_THREADS      (3U)
+#endif
+
+static volatile unsigned _flag = 0;
+static volatile uint32_t _count = 0;
+static mutex_t _mutex = MUTEX_INIT;
+
+static char _light_stack[THREAD_STACKSIZE_DEFAULT];
+static char _heavy_stacks[TEST_HEAVY_THREADS][THREAD_STACKSIZE_DEFAULT];
+static kernel_pid_t _light_pid;
+static xtimer_t _light_timer;
+
+static void _timer_callback(void *arg)
+{
+    (void)arg;
+
+    _flag = 1;
+}
+
+static void _light_timer_callback(void *arg)
+{
+    (void)arg;
+
+    if (!_flag) {
+        thread_wakeup(_light_pid);
+        xtimer_set(&_light_timer, TEST_LIGHT_PERIOD_US);
+    }
+}
+
+static void *_light_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        mutex_lock(&_mutex);
+        mutex_unlock(&_mutex);
+        thread_sleep();
+    }
+
+    return NULL;
+}
+
+static void _lock_loop(void)
+{
+    while (!_flag) {
+        mutex_lock(&_mutex);
+        /* let threads of the same priority contend while holding the lock */
+        thread_yield();
+        mutex_unlock(&_mutex);
+        _count++;
+    }
+}
+
+static void *_heavy_thread(void *arg)
+{
+    (void)arg;
+
+    _lock_loop();
+
+    return NULL;
+}
+
+static void _print_result(const char *name)
+{
+    printf("{ \"%s\" : %" PRIu32, name, _count);
+#ifdef MODULE_CORE_MUTEX_ADAPTIVE
+    printf(", \"contended\" : %" PRIu32 ", \"spun\" : %" PRIu32,
+           _mutex.stats.contended, _mutex.stats.spun);
+#endif
+    puts(" }");
+}
+
+static void _start(xtimer_t *timer)
+{
+    _flag = 0;
+    _count = 0;
+    mutex_init(&_mutex);
+    xtimer_set(timer, TEST_DURATION);
+}
+
+int main(void)
+{
+    printf("main starting\n");
+
+    xtimer_t timer;
+    timer.callback = _timer_callback;
+
+    /* no other thread uses the mutex */
+    _start(&timer);
+    _lock_loop();
+    _print_result("uncontended");
+
+    /* a higher priority thread locks the mutex every TEST_LIGHT_PERIOD_US,
+     * finding it locked whenever it preempts main within the lock */
+    _light_pid = thread_create(_light_stack, sizeof(_light_stack),
+                               THREAD_PRIORITY_MAIN - 1,
+                               THREAD_CREATE_SLEEPING | THREAD_CREATE_STACKTEST,
+                               _light_thread, NULL, "light");
+    _light_timer.callback = _light_timer_callback;
+    _start(&timer);
+    xtimer_set(&_light_timer, TEST_LIGHT_PERIOD_US);
+    _lock_loop();
+    _print_result("light");
+
+    /* TEST_HEAVY_THREADS threads of main's priority fight for the mutex */
+    _start(&timer);
+    for (unsigned i = 0; i < TEST_HEAVY_THREADS; i++) {
+        thread_create(_heavy_stacks[i], sizeof(_heavy_stacks[i]),
+                      THREAD_PRIORITY_MAIN,
+                      THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST,
+                      _heavy_thread, NULL, "heavy");
+    }
+    _lock_loop();
+    _print_result("heavy");
+
+    return 0;
+}
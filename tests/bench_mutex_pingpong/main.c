@@ -21,6 +21,7 @@
 #include <stdio.h>
 
 #include "macros/units.h"
+#include "msg.h"
 #include "mutex.h"
 #include "thread.h"
 #include "xtimer.h"
@@ -29,10 +30,29 @@
 #define TEST_DURATION       (1000000U)
 #endif
 
+#ifndef TEST_LATENCY_ROUNDS
+#define TEST_LATENCY_ROUNDS (16U)
+#endif
+
+/* time the low priority thread holds the mutex */
+#ifndef TEST_LOW_HOLD_US
+#define TEST_LOW_HOLD_US    (100U)
+#endif
+
+/* time the medium priority thread keeps the CPU busy */
+#ifndef TEST_MEDIUM_BUSY_US
+#define TEST_MEDIUM_BUSY_US (10000U)
+#endif
+
 volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
 static mutex_t _mutex = MUTEX_INIT;
 
+static char _low_stack[THREAD_STACKSIZE_DEFAULT];
+static char _medium_stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _shared = MUTEX_INIT;
+static kernel_pid_t _main_pid;
+
 static void _timer_callback(void*arg)
 {
     (void)arg;
@@ -52,6 +72,91 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void _busy_wait(uint32_t usec)
+{
+    uint32_t start = xtimer_now_usec();
+
+    while ((xtimer_now_usec() - start) < usec) {}
+}
+
+static void *_low_thread(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    while(1) {
+        msg_receive(&m);
+        mutex_lock(&_shared);
+        /* main preempts us and blocks on _shared */
+        thread_wakeup(_main_pid);
+        _busy_wait(TEST_LOW_HOLD_US);
+        mutex_unlock(&_shared);
+    }
+
+    return NULL;
+}
+
+static void *_medium_thread(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    while(1) {
+        msg_receive(&m);
+        _busy_wait(TEST_MEDIUM_BUSY_US);
+    }
+
+    return NULL;
+}
+
+/* Classic priority inversion: main blocks on a mutex held by a low priority
+ * thread while a medium priority thread hogs the CPU. Without priority
+ * inheritance, the latency of main is bounded by TEST_MEDIUM_BUSY_US, with
+ * priority inheritance by TEST_LOW_HOLD_US. */
+static void _measure_latency(void)
+{
+    _main_pid = thread_getpid();
+
+    kernel_pid_t low = thread_create(_low_stack,
+                                     sizeof(_low_stack),
+                                     THREAD_PRIORITY_MAIN + 2,
+                                     THREAD_CREATE_STACKTEST,
+                                     _low_thread,
+                                     NULL,
+                                     "low");
+    kernel_pid_t medium = thread_create(_medium_stack,
+                                        sizeof(_medium_stack),
+                                        THREAD_PRIORITY_MAIN + 1,
+                                        THREAD_CREATE_STACKTEST,
+                                        _medium_thread,
+                                        NULL,
+                                        "medium");
+
+    uint32_t max = 0;
+    uint32_t sum = 0;
+    msg_t m;
+
+    for (unsigned i = 0; i < TEST_LATENCY_ROUNDS; i++) {
+        msg_send(&m, low);
+        /* woken up by low once it holds the mutex */
+        thread_sleep();
+        msg_try_send(&m, medium);
+
+        uint32_t start = xtimer_now_usec();
+        mutex_lock(&_shared);
+        uint32_t latency = xtimer_now_usec() - start;
+        mutex_unlock(&_shared);
+
+        sum += latency;
+        if (latency > max) {
+            max = latency;
+        }
+    }
+
+    printf("{ \"latency_max_us\" : %"PRIu32", \"latency_avg_us\" : %"PRIu32
+           " }\n", max, sum / TEST_LATENCY_ROUNDS);
+}
+
 int main(void)
 {
     printf("main starting\n");
@@ -86,5 +191,7 @@ int main(void)
 #endif
     puts(" }");
 
+    _measure_latency();
+
     return 0;
 }
@@ -13,6 +13,7 @@ from testrunner import run
 
 def testfunc(child):
     child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    child.expect(r"{ \"latency_max_us\" : \d+, \"latency_avg_us\" : \d+ }")
 
 
 if __name__ == "__main__":
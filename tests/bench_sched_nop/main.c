@@ -30,6 +30,11 @@
 
 volatile unsigned _flag = 0;
 
+#ifdef MODULE_SCHED_ROUND_ROBIN
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static volatile uint32_t _busy_count = 0;
+#endif
+
 static void _timer_callback(void*arg)
 {
     (void)arg;
@@ -37,6 +42,58 @@ static void _timer_callback(void*arg)
     _flag = 1;
 }
 
+#ifdef MODULE_SCHED_ROUND_ROBIN
+static void *_busy_thread(void *arg)
+{
+    (void)arg;
+
+    while(!_flag) {
+        _busy_count++;
+    }
+
+    return NULL;
+}
+
+static uint32_t _busy_loop(void)
+{
+    xtimer_t timer;
+    timer.callback = _timer_callback;
+
+    uint32_t n = 0;
+
+    _flag = 0;
+    xtimer_set(&timer, TEST_DURATION);
+    while(!_flag) {
+        n++;
+    }
+
+    return n;
+}
+
+/* Count busy loop iterations within TEST_DURATION, first with main being the
+ * only thread at its priority (time slicing stays disarmed), then with a
+ * second CPU bound thread at the same priority, so that both only make
+ * progress because of time slicing. The difference of the sums is the
+ * overhead of the slice timer and the context switches it causes. */
+static void _measure_slicing(void)
+{
+    uint32_t single = _busy_loop();
+
+    thread_create(_stack,
+                  sizeof(_stack),
+                  THREAD_PRIORITY_MAIN,
+                  THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST,
+                  _busy_thread,
+                  NULL,
+                  "busy_thread");
+
+    uint32_t sliced = _busy_loop();
+
+    printf("{ \"single\" : %"PRIu32", \"sliced\" : %"PRIu32" }\n",
+           single, sliced + _busy_count);
+}
+#endif
+
 int main(void)
 {
     printf("main starting\n");
@@ -59,5 +116,9 @@ int main(void)
 #endif
     puts(" }");
 
+#ifdef MODULE_SCHED_ROUND_ROBIN
+    _measure_slicing();
+#endif
+
     return 0;
 }
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the cost of ztimer_now() and ztimer_now64()
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef TEST_READS
+#define TEST_READS      (100000UL)
+#endif
+
+static volatile uint64_t _sink;
+
+static uint32_t _ns_per_read(uint32_t start, uint32_t end)
+{
+    return ((uint64_t)(end - start) * NS_PER_US) / TEST_READS;
+}
+
+static void _bench(const char *name, ztimer_clock_t *clock)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned long i = 0; i < TEST_READS; i++) {
+        _sink = ztimer_now(clock);
+    }
+    uint32_t mid = ztimer_now(ZTIMER_USEC);
+    for (unsigned long i = 0; i < TEST_READS; i++) {
+        _sink = ztimer_now64(clock);
+    }
+    uint32_t end = ztimer_now(ZTIMER_USEC);
+
+    printf("{ \"clock\" : \"%s\", \"now_ns\" : %" PRIu32 ", "
+           "\"now64_ns\" : %" PRIu32 " }\n", name,
+           _ns_per_read(start, mid), _ns_per_read(mid, end));
+}
+
+int main(void)
+{
+    _bench("usec", ZTIMER_USEC);
+    _bench("msec", ZTIMER_MSEC);
+
+    puts("DONE");
+
+    return 0;
+}
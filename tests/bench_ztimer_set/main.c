@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure ztimer_set() and ztimer_remove() with many timers
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "random.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef TEST_MAX_TIMERS
+#define TEST_MAX_TIMERS         (1000U)
+#endif
+
+/* number of extra timers set and removed while measuring */
+#ifndef TEST_REPS
+#define TEST_REPS               (100U)
+#endif
+
+/* timeouts are far enough in the future to not trigger while measuring */
+#ifndef TEST_MIN_TIMEOUT
+#define TEST_MIN_TIMEOUT        (60LU * US_PER_SEC)
+#endif
+
+#ifndef TEST_MAX_TIMEOUT
+#define TEST_MAX_TIMEOUT        (600LU * US_PER_SEC)
+#endif
+
+static ztimer_t _timers[TEST_MAX_TIMERS];
+static ztimer_t _probes[TEST_REPS];
+static uint32_t _vals[TEST_REPS];
+
+static void _cb(void *arg)
+{
+    (void)arg;
+}
+
+static void _bench(unsigned count)
+{
+    for (unsigned i = 0; i < count; i++) {
+        _timers[i].callback = _cb;
+        ztimer_set(ZTIMER_USEC, &_timers[i],
+                   random_uint32_range(TEST_MIN_TIMEOUT, TEST_MAX_TIMEOUT));
+    }
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        _vals[i] = random_uint32_range(TEST_MIN_TIMEOUT, TEST_MAX_TIMEOUT);
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        ztimer_set(ZTIMER_USEC, &_probes[i], _vals[i]);
+    }
+    uint32_t set_us = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        ztimer_remove(ZTIMER_USEC, &_probes[i]);
+    }
+    uint32_t remove_us = ztimer_now(ZTIMER_USEC) - start;
+
+    for (unsigned i = 0; i < count; i++) {
+        ztimer_remove(ZTIMER_USEC, &_timers[i]);
+    }
+
+    printf("{ \"timers\" : %u, \"set_ns\" : %" PRIu32 ", "
+           "\"remove_ns\" : %" PRIu32 " }\n", count,
+           (uint32_t)(((uint64_t)set_us * NS_PER_US) / TEST_REPS),
+           (uint32_t)(((uint64_t)remove_us * NS_PER_US) / TEST_REPS));
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < TEST_REPS; i++) {
+        _probes[i].callback = _cb;
+    }
+
+    for (unsigned count = 10; count <= TEST_MAX_TIMERS; count *= 10) {
+        _bench(count);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
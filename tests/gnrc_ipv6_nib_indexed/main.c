@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Runs the NIB unittests with the indexed variants of the NIB's
+ *              tables
+ *
+ * @}
+ */
+
+#include "embUnit.h"
+
+#include "tests-gnrc_ipv6_nib.h"
+
+int main(void)
+{
+    TESTS_START();
+    tests_gnrc_ipv6_nib();
+    TESTS_END();
+
+    return 0;
+}
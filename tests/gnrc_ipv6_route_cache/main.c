@@ -0,0 +1,342 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the route cache of the IPv6 thread
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "embUnit.h"
+#include "msg.h"
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/ipv6/addr.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#include "_nib-internal.h"
+
+#define TEST_PAYLOAD_LEN        (8U)
+#define TEST_SEND_TIMEOUT       (100U * US_PER_MS)
+
+static const uint8_t _dev_addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+/* best source address for any neighbor */
+static const ipv6_addr_t _own_addr1 = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff, 0xff, 0xff
+    }
+};
+/* only used as source address once _own_addr1 is gone */
+static const ipv6_addr_t _own_addr2 = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0, 1, 0, 0, 0, 0, 0, 0, 0xff, 0xff, 0xff, 0xff
+    }
+};
+
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _main_msg_queue[2];
+static mutex_t _sent = MUTEX_INIT_LOCKED;
+static uint8_t _sent_l2dst[ETHERNET_ADDR_LEN];
+static ipv6_addr_t _sent_src;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_dev_addr));
+    memcpy(value, _dev_addr, sizeof(_dev_addr));
+    return sizeof(_dev_addr);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    const ethernet_hdr_t *hdr = iolist->iol_base;
+    const ipv6_hdr_t *ipv6 = iolist->iol_next->iol_base;
+
+    (void)dev;
+    if (hdr->dst[0] != 0x02) {
+        /* ignore neighbor discovery on multicast addresses */
+        return iolist_size(iolist);
+    }
+    memcpy(_sent_l2dst, hdr->dst, sizeof(_sent_l2dst));
+    memcpy(&_sent_src, &ipv6->src, sizeof(_sent_src));
+    mutex_unlock(&_sent);
+    return iolist_size(iolist);
+}
+
+/* neighbor 2001:db8::<n + 1> with link-layer address
+ * 02:00:00:<l2n>:00:<n + 1>, so packets to any neighbor are the only ones with
+ * 0x02 as first octet of the destination */
+static void _neighbor(ipv6_addr_t *addr, uint8_t *l2addr, uint8_t n,
+                      uint8_t l2n)
+{
+    ipv6_addr_from_str(addr, "2001:db8::");
+    addr->u16[7] = byteorder_htons(n + 1);
+    memset(l2addr, 0, ETHERNET_ADDR_LEN);
+    l2addr[0] = 0x02;
+    l2addr[3] = l2n;
+    l2addr[5] = n + 1;
+}
+
+static void _add_neighbor(uint8_t n, uint8_t l2n)
+{
+    ipv6_addr_t addr;
+    uint8_t l2addr[ETHERNET_ADDR_LEN];
+
+    _neighbor(&addr, l2addr, n, l2n);
+    expect(gnrc_ipv6_nib_nc_set(&addr, _netif.pid, l2addr,
+                                sizeof(l2addr)) == 0);
+}
+
+static void _del_neighbor(uint8_t n)
+{
+    ipv6_addr_t addr;
+    uint8_t l2addr[ETHERNET_ADDR_LEN];
+
+    _neighbor(&addr, l2addr, n, 0);
+    gnrc_ipv6_nib_nc_del(&addr, _netif.pid);
+}
+
+/* sends a packet without source address to neighbor n */
+static bool _dispatch_to(uint8_t n)
+{
+    static const uint8_t payload[TEST_PAYLOAD_LEN] = { 0 };
+    ipv6_addr_t dst;
+    uint8_t l2addr[ETHERNET_ADDR_LEN];
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, payload, sizeof(payload),
+                                          GNRC_NETTYPE_UNDEF);
+
+    _neighbor(&dst, l2addr, n, 0);
+    if ((pkt == NULL) ||
+        ((pkt = gnrc_ipv6_hdr_build(pkt, NULL, &dst)) == NULL)) {
+        puts("error: unable to allocate packet");
+        return false;
+    }
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_IPV6,
+                                   GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        puts("error: no IPv6 thread");
+        gnrc_pktbuf_release(pkt);
+        return false;
+    }
+    return true;
+}
+
+/* waits for a packet to leave the interface */
+static bool _wait_sent(void)
+{
+    return xtimer_mutex_lock_timeout(&_sent, TEST_SEND_TIMEOUT) == 0;
+}
+
+/* sends a packet to neighbor n and stores the NIB generation in gen once it
+ * left the interface */
+static bool _send_to(uint8_t n, uint32_t *gen)
+{
+    if (!_dispatch_to(n) || !_wait_sent()) {
+        return false;
+    }
+    *gen = gnrc_ipv6_nib_gen();
+    return true;
+}
+
+/* sends a packet to neighbor n while the NIB is locked, so it only leaves the
+ * interface in time if the route cache provides the next hop */
+static bool _send_cached_to(uint8_t n)
+{
+    bool sent;
+
+    _nib_acquire();
+    if (!_dispatch_to(n)) {
+        _nib_release();
+        return false;
+    }
+    sent = _wait_sent();
+    _nib_release();
+    if (!sent) {
+        /* the IPv6 thread continues with the lookup now */
+        _wait_sent();
+    }
+    return sent;
+}
+
+static void _assert_sent(uint8_t n, uint8_t l2n, const ipv6_addr_t *src)
+{
+    ipv6_addr_t addr;
+    uint8_t l2addr[ETHERNET_ADDR_LEN];
+
+    _neighbor(&addr, l2addr, n, l2n);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(l2addr, _sent_l2dst, sizeof(l2addr)));
+    TEST_ASSERT(ipv6_addr_equal(src, &_sent_src));
+}
+
+static void set_up(void)
+{
+    /* valid right away, so source address selection does not need to wait
+     * for duplicate address detection */
+    expect(gnrc_netif_ipv6_addr_add_internal(
+                &_netif, &_own_addr1, 64,
+                GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID
+            ) >= 0);
+    expect(gnrc_netif_ipv6_addr_add_internal(
+                &_netif, &_own_addr2, 64,
+                GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID
+            ) >= 0);
+    _add_neighbor(0, 0);
+    _add_neighbor(1, 0);
+}
+
+static void tear_down(void)
+{
+    _del_neighbor(0);
+    _del_neighbor(1);
+}
+
+/*
+ * Sends two packets to the same neighbor.
+ * Expected result: the second packet is sent to the same link-layer address
+ * without accessing the NIB
+ */
+static void test_route_cache__hit(void)
+{
+    uint32_t gen;
+
+    TEST_ASSERT(_send_to(0, &gen));
+    _assert_sent(0, 0, &_own_addr1);
+    TEST_ASSERT(_send_cached_to(0));
+    _assert_sent(0, 0, &_own_addr1);
+    TEST_ASSERT_EQUAL_INT(gen, gnrc_ipv6_nib_gen());
+}
+
+/*
+ * Sends a packet to a neighbor, then changes the link-layer address of that
+ * neighbor and sends two more.
+ * Expected result: the NIB is asked for the second packet, which is sent to
+ * the new link-layer address, the third one is sent from the cache again
+ */
+static void test_route_cache__nib_changed(void)
+{
+    uint32_t gen;
+
+    TEST_ASSERT(_send_to(0, &gen));
+    _assert_sent(0, 0, &_own_addr1);
+    _del_neighbor(0);
+    _add_neighbor(0, 1);
+    TEST_ASSERT(gen != gnrc_ipv6_nib_gen());
+    TEST_ASSERT(!_send_cached_to(0));
+    _assert_sent(0, 1, &_own_addr1);
+    TEST_ASSERT(_send_cached_to(0));
+    _assert_sent(0, 1, &_own_addr1);
+}
+
+/*
+ * Sends a packet to a neighbor, then to another neighbor, then alternately to
+ * both of them.
+ * Expected result: the lookups do not change the NIB, so the packets of both
+ * flows are sent to their link-layer address without accessing the NIB
+ */
+static void test_route_cache__interleaved(void)
+{
+    uint32_t gen, next_gen;
+
+    TEST_ASSERT(_send_to(0, &gen));
+    _assert_sent(0, 0, &_own_addr1);
+    TEST_ASSERT(_send_to(1, &next_gen));
+    _assert_sent(1, 0, &_own_addr1);
+    TEST_ASSERT_EQUAL_INT(gen, next_gen);
+    for (unsigned i = 0; i < 4; i++) {
+        uint8_t n = i % 2;
+
+        TEST_ASSERT(_send_cached_to(n));
+        _assert_sent(n, 0, &_own_addr1);
+    }
+    TEST_ASSERT_EQUAL_INT(gen, gnrc_ipv6_nib_gen());
+}
+
+/*
+ * Sends a packet to a neighbor, then removes the source address chosen for it
+ * from the interface and sends again.
+ * Expected result: the second packet comes from the other address, even though
+ * the NIB did not change
+ */
+static void test_route_cache__src_removed(void)
+{
+    uint32_t gen;
+
+    TEST_ASSERT(_send_to(0, &gen));
+    _assert_sent(0, 0, &_own_addr1);
+    gnrc_netif_ipv6_addr_remove_internal(&_netif, &_own_addr1);
+    TEST_ASSERT(_send_cached_to(0));
+    _assert_sent(0, 0, &_own_addr2);
+}
+
+static Test *tests_gnrc_ipv6_route_cache(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_route_cache__hit),
+        new_TestFixture(test_route_cache__nib_changed),
+        new_TestFixture(test_route_cache__interleaved),
+        new_TestFixture(test_route_cache__src_removed),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, tear_down, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, ARRAY_SIZE(_main_msg_queue));
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_dev, _send);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "netdev_test", &_dev.netdev) == 0);
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_ipv6_route_cache());
+    TESTS_END();
+
+    return 0;
+}
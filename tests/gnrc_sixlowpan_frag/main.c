@@ -444,6 +444,22 @@ static void test_rbuf_add__too_big_fragment(void)
     _check_pktbuf(NULL);
 }
 
+static void test_rbuf_add__empty_fragment(void)
+{
+    /* only the fragment header, without any of the datagram */
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _fragment2,
+                                          sizeof(sixlowpan_frag_n_t),
+                                          GNRC_NETTYPE_SIXLOWPAN);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NULL(gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt, TEST_FRAGMENT2_OFFSET, TEST_PAGE
+        ));
+    /* packet buffer is empty*/
+    TEST_ASSERT_NULL(_first_non_empty_rbuf());
+    _check_pktbuf(NULL);
+}
+
 static void test_rbuf_add__overlap_lhs(void)
 {
     static const size_t pkt2_offset = TEST_FRAGMENT2_OFFSET - 8U;
@@ -629,6 +645,7 @@ static void run_unittests(void)
         new_TestFixture(test_rbuf_add__success_complete),
         new_TestFixture(test_rbuf_add__full_rbuf),
         new_TestFixture(test_rbuf_add__too_big_fragment),
+        new_TestFixture(test_rbuf_add__empty_fragment),
         new_TestFixture(test_rbuf_add__overlap_lhs),
         new_TestFixture(test_rbuf_add__overlap_rhs),
         new_TestFixture(test_rbuf_exists),
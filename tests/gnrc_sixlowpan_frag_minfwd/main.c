@@ -0,0 +1,342 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests minimal fragment forwarding of gnrc stack
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "byteorder.h"
+#include "embUnit.h"
+#include "iolist.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/gnrc/sixlowpan/frag/minfwd.h"
+#include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#include "net/ieee802154.h"
+#include "net/netdev_test.h"
+#include "net/sixlowpan.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define TEST_DATAGRAM_SIZE      (96U)
+#define TEST_FRAG_SIZE          (32U)
+#define TEST_TAG                (0x690e)
+#define TEST_PAGE               (0)
+#define TEST_DST        { 0x5a, 0x9d, 0x93, 0x86, 0x22, 0x08, 0x65, 0x79 }
+#define TEST_SRC        { 0x2a, 0xab, 0xdc, 0x15, 0x54, 0x01, 0x64, 0x79 }
+#define TEST_NEXT_HOP   { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22, 0xfd, 0x0a }
+
+static const uint8_t _test_src[] = TEST_SRC;
+static const uint8_t _test_dst[] = TEST_DST;
+static const uint8_t _test_next_hop[] = TEST_NEXT_HOP;
+
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+/* last frame sent by _netif, without its MAC header */
+static uint8_t _sent_frame[IEEE802154_FRAME_LEN_MAX];
+static size_t _sent_frame_len;
+static uint8_t _sent_dst[IEEE802154_LONG_ADDRESS_LEN];
+static int _sent_dst_len;
+static unsigned _sent;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = 102U;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_test_dst);
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_test_dst));
+    memcpy(value, _test_dst, sizeof(_test_dst));
+    return sizeof(_test_dst);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    le_uint16_t dst_pan;
+
+    (void)dev;
+    /* first entry is the MAC header */
+    _sent_dst_len = ieee802154_get_dst(iolist->iol_base, _sent_dst, &dst_pan);
+    _sent_frame_len = 0;
+    for (const iolist_t *ptr = iolist->iol_next; ptr != NULL;
+         ptr = ptr->iol_next) {
+        expect((_sent_frame_len + ptr->iol_len) <= sizeof(_sent_frame));
+        memcpy(&_sent_frame[_sent_frame_len], ptr->iol_base, ptr->iol_len);
+        _sent_frame_len += ptr->iol_len;
+    }
+    _sent++;
+    return iolist_size(iolist);
+}
+
+static gnrc_pktsnip_t *_netif_hdr(void)
+{
+    gnrc_pktsnip_t *netif = gnrc_netif_hdr_build(_test_src, sizeof(_test_src),
+                                                 _test_dst, sizeof(_test_dst));
+
+    if (netif != NULL) {
+        gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    }
+    return netif;
+}
+
+/* subsequent fragment as received from TEST_SRC, the payload bytes are the
+ * offset in units of 8 bytes */
+static gnrc_pktsnip_t *_build_frag_n(unsigned offset, unsigned size)
+{
+    gnrc_pktsnip_t *pkt = _netif_hdr();
+    sixlowpan_frag_n_t *hdr;
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    pkt = gnrc_pktbuf_add(pkt, NULL, sizeof(*hdr) + size,
+                          GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        return NULL;
+    }
+    hdr = pkt->data;
+    hdr->disp_size = byteorder_htons(TEST_DATAGRAM_SIZE);
+    hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+    hdr->tag = byteorder_htons(TEST_TAG);
+    hdr->offset = offset / 8;
+    memset(hdr + 1, offset / 8, size);
+    return pkt;
+}
+
+static gnrc_sixlowpan_frag_vrb_t *_add_vrbe(void)
+{
+    gnrc_sixlowpan_frag_rb_base_t base = {
+        .src = TEST_SRC,
+        .src_len = sizeof(_test_src),
+        .tag = TEST_TAG,
+        .datagram_size = TEST_DATAGRAM_SIZE,
+        /* the first fragment was already forwarded */
+        .current_size = TEST_FRAG_SIZE,
+    };
+
+    return gnrc_sixlowpan_frag_vrb_add(&base, &_netif, _test_next_hop,
+                                       sizeof(_test_next_hop));
+}
+
+static void _recv_frag_n(unsigned offset, unsigned size)
+{
+    gnrc_pktsnip_t *pkt = _build_frag_n(offset, size);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    /* the interface has a higher priority, so a forwarded fragment is sent
+     * before this returns */
+    gnrc_sixlowpan_frag_recv(pkt, NULL, TEST_PAGE);
+}
+
+static void _check_sent_frag_n(const gnrc_sixlowpan_frag_vrb_t *vrbe,
+                               unsigned offset, unsigned size)
+{
+    sixlowpan_frag_n_t *hdr = (sixlowpan_frag_n_t *)_sent_frame;
+
+    TEST_ASSERT_EQUAL_INT(sizeof(_test_next_hop), _sent_dst_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_test_next_hop, _sent_dst,
+                                    sizeof(_test_next_hop)));
+    TEST_ASSERT_EQUAL_INT(sizeof(*hdr) + size, _sent_frame_len);
+    TEST_ASSERT(sixlowpan_frag_n_is((sixlowpan_frag_t *)hdr));
+    TEST_ASSERT_EQUAL_INT(TEST_DATAGRAM_SIZE,
+                          sixlowpan_frag_datagram_size((sixlowpan_frag_t *)hdr));
+    TEST_ASSERT_EQUAL_INT(vrbe->out_tag, byteorder_ntohs(hdr->tag));
+    TEST_ASSERT_EQUAL_INT(offset, sixlowpan_frag_offset(hdr));
+    for (unsigned i = 0; i < size; i++) {
+        TEST_ASSERT_EQUAL_INT(offset / 8, _sent_frame[sizeof(*hdr) + i]);
+    }
+}
+
+static void _check_pktbuf(void)
+{
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_sane(), "Packet buffer is not sane");
+    TEST_ASSERT_MESSAGE(gnrc_pktbuf_is_empty(), "Packet buffer is not empty");
+}
+
+static void set_up(void)
+{
+    gnrc_sixlowpan_frag_rb_reset();
+    gnrc_sixlowpan_frag_vrb_reset();
+    gnrc_pktbuf_init();
+    _sent = 0;
+}
+
+static void test_minfwd_forward__subsequent_fragment(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe = _add_vrbe();
+
+    TEST_ASSERT_NOT_NULL(vrbe);
+    _recv_frag_n(TEST_FRAG_SIZE, TEST_FRAG_SIZE);
+    TEST_ASSERT_EQUAL_INT(1, _sent);
+    _check_sent_frag_n(vrbe, TEST_FRAG_SIZE, TEST_FRAG_SIZE);
+    /* entry still waits for the last fragment */
+    TEST_ASSERT(vrbe == gnrc_sixlowpan_frag_vrb_get(_test_src,
+                                                    sizeof(_test_src),
+                                                    TEST_TAG));
+    _check_pktbuf();
+}
+
+static void test_minfwd_forward__complete(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe = _add_vrbe();
+    uint16_t out_tag;
+
+    TEST_ASSERT_NOT_NULL(vrbe);
+    out_tag = vrbe->out_tag;
+    _recv_frag_n(2 * TEST_FRAG_SIZE, TEST_FRAG_SIZE);
+    TEST_ASSERT_EQUAL_INT(1, _sent);
+    _check_sent_frag_n(vrbe, 2 * TEST_FRAG_SIZE, TEST_FRAG_SIZE);
+    _recv_frag_n(TEST_FRAG_SIZE, TEST_FRAG_SIZE);
+    TEST_ASSERT_EQUAL_INT(2, _sent);
+    TEST_ASSERT_EQUAL_INT(out_tag, byteorder_ntohs(
+            ((sixlowpan_frag_n_t *)_sent_frame)->tag
+        ));
+    /* entry is removed when the datagram was forwarded completely */
+    TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_get(_test_src, sizeof(_test_src),
+                                                 TEST_TAG));
+    _check_pktbuf();
+}
+
+static void test_minfwd_forward__duplicate(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe = _add_vrbe();
+
+    TEST_ASSERT_NOT_NULL(vrbe);
+    _recv_frag_n(TEST_FRAG_SIZE, TEST_FRAG_SIZE);
+    TEST_ASSERT_EQUAL_INT(1, _sent);
+    _recv_frag_n(TEST_FRAG_SIZE, TEST_FRAG_SIZE);
+    /* the duplicate was dropped */
+    TEST_ASSERT_EQUAL_INT(1, _sent);
+    TEST_ASSERT(vrbe == gnrc_sixlowpan_frag_vrb_get(_test_src,
+                                                    sizeof(_test_src),
+                                                    TEST_TAG));
+    _check_pktbuf();
+}
+
+static void test_minfwd_forward__overlap(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe = _add_vrbe();
+
+    TEST_ASSERT_NOT_NULL(vrbe);
+    _recv_frag_n(TEST_FRAG_SIZE, TEST_FRAG_SIZE);
+    TEST_ASSERT_EQUAL_INT(1, _sent);
+    /* overlaps the second half of the forwarded fragment */
+    _recv_frag_n(TEST_FRAG_SIZE + (TEST_FRAG_SIZE / 2), TEST_FRAG_SIZE);
+    TEST_ASSERT_EQUAL_INT(1, _sent);
+    _check_sent_frag_n(vrbe, TEST_FRAG_SIZE, TEST_FRAG_SIZE);
+    _check_pktbuf();
+}
+
+static void test_minfwd_frag_iphc(void)
+{
+    static const uint8_t payload[] = {
+        0x7a, 0x33, 0x3a, 0x80, 0x00, 0xf5, 0x4e, 0x15,
+        0x2c, 0x00, 0x01, 0x00, 0x01, 0x02, 0x03, 0x04,
+    };
+    gnrc_sixlowpan_frag_vrb_t *vrbe = _add_vrbe();
+    gnrc_pktsnip_t *pkt, *netif;
+    sixlowpan_frag_t *hdr = (sixlowpan_frag_t *)_sent_frame;
+
+    TEST_ASSERT_NOT_NULL(vrbe);
+    /* recompressed headers and payload of the first fragment with the netif
+     * header of the received fragment in front */
+    TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(NULL, payload, sizeof(payload),
+                                                GNRC_NETTYPE_SIXLOWPAN)));
+    TEST_ASSERT_NOT_NULL((netif = _netif_hdr()));
+    pkt = gnrc_pkt_prepend(pkt, netif);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_sixlowpan_frag_minfwd_frag_iphc(pkt, vrbe,
+                                                                  TEST_PAGE));
+    TEST_ASSERT_EQUAL_INT(1, _sent);
+    TEST_ASSERT_EQUAL_INT(sizeof(_test_next_hop), _sent_dst_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_test_next_hop, _sent_dst,
+                                    sizeof(_test_next_hop)));
+    TEST_ASSERT_EQUAL_INT(sizeof(*hdr) + sizeof(payload), _sent_frame_len);
+    TEST_ASSERT(sixlowpan_frag_1_is(hdr));
+    TEST_ASSERT_EQUAL_INT(TEST_DATAGRAM_SIZE,
+                          sixlowpan_frag_datagram_size(hdr));
+    TEST_ASSERT_EQUAL_INT(vrbe->out_tag, byteorder_ntohs(hdr->tag));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(payload, hdr + 1, sizeof(payload)));
+    _check_pktbuf();
+}
+
+static Test *tests_gnrc_sixlowpan_frag_minfwd(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_minfwd_forward__subsequent_fragment),
+        new_TestFixture(test_minfwd_forward__complete),
+        new_TestFixture(test_minfwd_forward__duplicate),
+        new_TestFixture(test_minfwd_forward__overlap),
+        new_TestFixture(test_minfwd_frag_iphc),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_address_long);
+    netdev_test_set_send_cb(&_dev, _send);
+    expect(gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                        sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                        "netdev_test",
+                                        &_dev.netdev.netdev) == 0);
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_sixlowpan_frag_minfwd());
+    TESTS_END();
+
+    return 0;
+}
@@ -0,0 +1,469 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests window scaling, SACK and out-of-order segments of gnrc_tcp
+ *
+ * The test feeds crafted segments of a peer into the FSM of a connection and
+ * inspects the segments built in return.
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "embUnit.h"
+#include "net/gnrc.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+#include "net/ipv6/addr.h"
+#include "net/ipv6/hdr.h"
+#include "net/tcp.h"
+#include "test_utils/expect.h"
+
+#include "gnrc_tcp_common.h"
+#include "gnrc_tcp_fsm.h"
+#include "gnrc_tcp_pkt.h"
+
+#define LOCAL_PORT      (80U)
+#define PEER_PORT       (2000U)
+/* initial sequence number of the peer, close to the wrap around */
+#define PEER_ISS        (0xfffffff0U)
+/* first sequence number of the peer's data */
+#define PEER_SEQ        (PEER_ISS + 1)
+#define PEER_WND        (1000U)
+#define PEER_WS         (3U)
+#define SEG_LEN         (10U)
+/* maximum size of the options of a TCP header */
+#define OPTS_MAX        (40U)
+
+static const ipv6_addr_t _local_addr = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    }
+};
+static const ipv6_addr_t _peer_addr = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    }
+};
+/* MSS 1220, window scale PEER_WS, SACK permitted */
+static const uint8_t _opts_all[] = {
+    TCP_OPTION_KIND_MSS, TCP_OPTION_LENGTH_MSS, 0x04, 0xc4,
+    TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_WS, TCP_OPTION_LENGTH_WS, PEER_WS,
+    TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+    TCP_OPTION_KIND_SACK_PERM, TCP_OPTION_LENGTH_SACK_PERM,
+};
+/* MSS 1220 */
+static const uint8_t _opts_mss[] = {
+    TCP_OPTION_KIND_MSS, TCP_OPTION_LENGTH_MSS, 0x04, 0xc4,
+};
+/* window scale 7 */
+static const uint8_t _opts_ws[] = {
+    TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_WS, TCP_OPTION_LENGTH_WS, 7,
+};
+
+/* exceeds the window field, so that the receive window is scaled by 1 */
+static uint8_t _rcv_buf[UINT16_MAX + 1];
+static gnrc_tcp_tcb_t _tcb;
+
+/* feeds a segment of the peer, acknowledging everything sent, into the FSM */
+static void _rcvd(uint32_t seq, uint16_t ctl, const uint8_t *opts,
+                  size_t opts_len, size_t payload_len)
+{
+    uint8_t hdr[sizeof(tcp_hdr_t) + OPTS_MAX] = { 0 };
+    tcp_hdr_t *tcp_hdr = (tcp_hdr_t *)hdr;
+    size_t hdr_len = sizeof(tcp_hdr_t) + opts_len;
+    ipv6_hdr_t ipv6_hdr = { 0 };
+    gnrc_pktsnip_t *pkt = NULL;
+
+    expect((opts_len % 4) == 0);
+    expect(opts_len <= OPTS_MAX);
+    ipv6_hdr_set_version(&ipv6_hdr);
+    ipv6_hdr.nh = PROTNUM_TCP;
+    ipv6_hdr.hl = 64;
+    ipv6_hdr.src = _peer_addr;
+    ipv6_hdr.dst = _local_addr;
+    tcp_hdr->src_port = byteorder_htons(PEER_PORT);
+    tcp_hdr->dst_port = byteorder_htons(LOCAL_PORT);
+    tcp_hdr->seq_num = byteorder_htonl(seq);
+    tcp_hdr->ack_num = byteorder_htonl(_tcb.snd_nxt);
+    tcp_hdr->off_ctl = byteorder_htons(((hdr_len / 4) << 12) | ctl);
+    tcp_hdr->window = byteorder_htons(PEER_WND);
+    memcpy(hdr + sizeof(tcp_hdr_t), opts, opts_len);
+
+    if (payload_len > 0) {
+        pkt = gnrc_pktbuf_add(NULL, NULL, payload_len, GNRC_NETTYPE_UNDEF);
+        expect(pkt != NULL);
+        /* every byte holds the low byte of its offset in the peer's stream */
+        for (size_t i = 0; i < payload_len; i++) {
+            ((uint8_t *)pkt->data)[i] = (uint8_t)(seq - PEER_SEQ + i);
+        }
+    }
+    pkt = gnrc_pktbuf_add(pkt, hdr, hdr_len, GNRC_NETTYPE_TCP);
+    expect(pkt != NULL);
+    pkt = gnrc_pktbuf_add(pkt, &ipv6_hdr, sizeof(ipv6_hdr), GNRC_NETTYPE_IPV6);
+    expect(pkt != NULL);
+    _gnrc_tcp_fsm(&_tcb, FSM_EVENT_RCVD_PKT, pkt, NULL, 0);
+    gnrc_pktbuf_release(pkt);
+}
+
+static const uint8_t *_find_opt(const gnrc_pktsnip_t *tcp, uint8_t kind)
+{
+    const uint8_t *opt = (const uint8_t *)tcp->data + sizeof(tcp_hdr_t);
+    const uint8_t *end = (const uint8_t *)tcp->data + tcp->size;
+
+    while ((opt < end) && (*opt != TCP_OPTION_KIND_EOL)) {
+        if (*opt == TCP_OPTION_KIND_NOP) {
+            opt++;
+            continue;
+        }
+        if (*opt == kind) {
+            return opt;
+        }
+        opt += opt[1];
+    }
+    return NULL;
+}
+
+static uint16_t _window(const gnrc_pktsnip_t *tcp)
+{
+    return byteorder_ntohs(((tcp_hdr_t *)tcp->data)->window);
+}
+
+/* the SYN or SYN+ACK waiting for its acknowledgment */
+static gnrc_pktsnip_t *_sent_syn(void)
+{
+    expect(_tcb.pkt_retransmit != NULL);
+    return gnrc_pktsnip_search_type(_tcb.pkt_retransmit, GNRC_NETTYPE_TCP);
+}
+
+static gnrc_pktsnip_t *_build_ack(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+    uint16_t seq_con = 0;
+
+    expect(_gnrc_tcp_pkt_build(&_tcb, &pkt, &seq_con, MSK_ACK, _tcb.snd_nxt,
+                               _tcb.rcv_nxt, NULL, 0) == 0);
+    return pkt;
+}
+
+/* SACK blocks of a freshly built ACK, relative to PEER_SEQ */
+static unsigned _sack_blocks(uint32_t *edges)
+{
+    gnrc_pktsnip_t *pkt = _build_ack();
+    const uint8_t *opt = _find_opt(gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP),
+                                   TCP_OPTION_KIND_SACK);
+    unsigned blocks = 0;
+
+    if (opt != NULL) {
+        blocks = (opt[1] - 2) / 8;
+        for (unsigned i = 0; i < (2 * blocks); i++) {
+            edges[i] = byteorder_bebuftohl(&opt[2 + (4 * i)]) - PEER_SEQ;
+        }
+    }
+    gnrc_pktbuf_release(pkt);
+    return blocks;
+}
+
+static void _listen(bool big_buf)
+{
+    if (big_buf) {
+        expect(gnrc_tcp_tcb_set_rcv_buf(&_tcb, _rcv_buf, sizeof(_rcv_buf)) == 0);
+    }
+    _tcb.status |= STATUS_PASSIVE | STATUS_ALLOW_ANY_ADDR;
+    _tcb.local_port = LOCAL_PORT;
+    expect(_gnrc_tcp_fsm(&_tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0) == 0);
+}
+
+static void _connect(bool big_buf)
+{
+    if (big_buf) {
+        expect(gnrc_tcp_tcb_set_rcv_buf(&_tcb, _rcv_buf, sizeof(_rcv_buf)) == 0);
+    }
+    memcpy(_tcb.local_addr, &_local_addr, sizeof(_local_addr));
+    memcpy(_tcb.peer_addr, &_peer_addr, sizeof(_peer_addr));
+    _tcb.local_port = LOCAL_PORT;
+    _tcb.peer_port = PEER_PORT;
+    expect(_gnrc_tcp_fsm(&_tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0) == 0);
+}
+
+/* passive open with a big receive buffer, the peer offers everything */
+static void _establish(void)
+{
+    _listen(true);
+    _rcvd(PEER_ISS, MSK_SYN, _opts_all, sizeof(_opts_all), 0);
+    _rcvd(PEER_SEQ, MSK_ACK, NULL, 0, 0);
+    expect(_tcb.state == FSM_STATE_ESTABLISHED);
+}
+
+static void set_up(void)
+{
+    gnrc_tcp_tcb_init(&_tcb);
+}
+
+static void tear_down(void)
+{
+    if (_tcb.state != FSM_STATE_CLOSED) {
+        _gnrc_tcp_fsm(&_tcb, FSM_EVENT_CALL_ABORT, NULL, NULL, 0);
+    }
+}
+
+/*
+ * Passive open with a receive buffer exceeding 64 KiB, the peer offers window
+ * scaling and SACK.
+ * Expected result: both are accepted, the SYN+ACK offers them in return, the
+ * windows of the SYNs are unscaled, all later windows are scaled in both
+ * directions and a window scale option after the SYN is ignored
+ */
+static void test_ws_sack__accepted(void)
+{
+    gnrc_pktsnip_t *pkt, *tcp;
+    const uint8_t *opt;
+
+    _listen(true);
+    _rcvd(PEER_ISS, MSK_SYN, _opts_all, sizeof(_opts_all), 0);
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_SYN_RCVD, _tcb.state);
+    TEST_ASSERT(_tcb.status & STATUS_WSCALE);
+    TEST_ASSERT(_tcb.status & STATUS_SACK);
+    TEST_ASSERT_EQUAL_INT(PEER_WS, _tcb.snd_wnd_scale);
+    TEST_ASSERT_EQUAL_INT(1, _tcb.rcv_wnd_scale);
+    TEST_ASSERT_EQUAL_INT(PEER_WND, _tcb.snd_wnd);
+
+    tcp = _sent_syn();
+    opt = _find_opt(tcp, TCP_OPTION_KIND_WS);
+    TEST_ASSERT_NOT_NULL(opt);
+    TEST_ASSERT_EQUAL_INT(1, opt[2]);
+    TEST_ASSERT_NOT_NULL(_find_opt(tcp, TCP_OPTION_KIND_SACK_PERM));
+    TEST_ASSERT_EQUAL_INT(UINT16_MAX, _window(tcp));
+
+    _rcvd(PEER_SEQ, MSK_ACK, NULL, 0, 0);
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_ESTABLISHED, _tcb.state);
+    TEST_ASSERT_EQUAL_INT(PEER_WND << PEER_WS, _tcb.snd_wnd);
+
+    pkt = _build_ack();
+    tcp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    TEST_ASSERT_EQUAL_INT(sizeof(_rcv_buf) >> 1, _window(tcp));
+    TEST_ASSERT_NULL(_find_opt(tcp, TCP_OPTION_KIND_WS));
+    TEST_ASSERT_NULL(_find_opt(tcp, TCP_OPTION_KIND_SACK_PERM));
+    gnrc_pktbuf_release(pkt);
+
+    _rcvd(PEER_SEQ, MSK_ACK, _opts_ws, sizeof(_opts_ws), 0);
+    TEST_ASSERT_EQUAL_INT(PEER_WS, _tcb.snd_wnd_scale);
+    TEST_ASSERT_EQUAL_INT(PEER_WND << PEER_WS, _tcb.snd_wnd);
+}
+
+/*
+ * Passive open with a receive buffer exceeding 64 KiB, the peer offers
+ * neither window scaling nor SACK.
+ * Expected result: neither is used nor offered in the SYN+ACK, the windows
+ * are unscaled and the window sent is clamped to the window field
+ */
+static void test_ws_sack__not_offered(void)
+{
+    gnrc_pktsnip_t *pkt, *tcp;
+
+    _listen(true);
+    _rcvd(PEER_ISS, MSK_SYN, _opts_mss, sizeof(_opts_mss), 0);
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_SYN_RCVD, _tcb.state);
+    TEST_ASSERT(!(_tcb.status & (STATUS_WSCALE | STATUS_SACK)));
+    TEST_ASSERT_EQUAL_INT(0, _tcb.snd_wnd_scale);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.rcv_wnd_scale);
+
+    tcp = _sent_syn();
+    TEST_ASSERT_NULL(_find_opt(tcp, TCP_OPTION_KIND_WS));
+    TEST_ASSERT_NULL(_find_opt(tcp, TCP_OPTION_KIND_SACK_PERM));
+
+    _rcvd(PEER_SEQ, MSK_ACK, NULL, 0, 0);
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_ESTABLISHED, _tcb.state);
+    TEST_ASSERT_EQUAL_INT(PEER_WND, _tcb.snd_wnd);
+
+    pkt = _build_ack();
+    TEST_ASSERT_EQUAL_INT(UINT16_MAX,
+                          _window(gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP)));
+    gnrc_pktbuf_release(pkt);
+}
+
+/*
+ * Passive open with the default receive buffer, the peer offers window
+ * scaling and SACK.
+ * Expected result: SACK is accepted, window scaling is not, as the receive
+ * window fits into the window field
+ */
+static void test_ws_sack__small_buffer(void)
+{
+    gnrc_pktsnip_t *tcp;
+
+    _listen(false);
+    _rcvd(PEER_ISS, MSK_SYN, _opts_all, sizeof(_opts_all), 0);
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_SYN_RCVD, _tcb.state);
+    TEST_ASSERT(!(_tcb.status & STATUS_WSCALE));
+    TEST_ASSERT(_tcb.status & STATUS_SACK);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.snd_wnd_scale);
+
+    tcp = _sent_syn();
+    TEST_ASSERT_NULL(_find_opt(tcp, TCP_OPTION_KIND_WS));
+    TEST_ASSERT_NOT_NULL(_find_opt(tcp, TCP_OPTION_KIND_SACK_PERM));
+
+    _rcvd(PEER_SEQ, MSK_ACK, NULL, 0, 0);
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_ESTABLISHED, _tcb.state);
+    TEST_ASSERT_EQUAL_INT(PEER_WND, _tcb.snd_wnd);
+}
+
+/*
+ * Active opens with the default and with a big receive buffer, the peer's
+ * SYN+ACK carries no options.
+ * Expected result: SACK is always offered, window scaling only with the big
+ * buffer, and neither is used after the SYN+ACK
+ */
+static void test_ws_sack__active(void)
+{
+    gnrc_pktsnip_t *pkt, *tcp;
+
+    _connect(false);
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_SYN_SENT, _tcb.state);
+    tcp = _sent_syn();
+    TEST_ASSERT_NULL(_find_opt(tcp, TCP_OPTION_KIND_WS));
+    TEST_ASSERT_NOT_NULL(_find_opt(tcp, TCP_OPTION_KIND_SACK_PERM));
+    tear_down();
+
+    set_up();
+    _connect(true);
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_SYN_SENT, _tcb.state);
+    tcp = _sent_syn();
+    TEST_ASSERT_NOT_NULL(_find_opt(tcp, TCP_OPTION_KIND_WS));
+    TEST_ASSERT_EQUAL_INT(1, _find_opt(tcp, TCP_OPTION_KIND_WS)[2]);
+    TEST_ASSERT_NOT_NULL(_find_opt(tcp, TCP_OPTION_KIND_SACK_PERM));
+    TEST_ASSERT_EQUAL_INT(UINT16_MAX, _window(tcp));
+
+    _rcvd(PEER_ISS, MSK_SYN_ACK, _opts_mss, sizeof(_opts_mss), 0);
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_ESTABLISHED, _tcb.state);
+    TEST_ASSERT(!(_tcb.status & (STATUS_WSCALE | STATUS_SACK)));
+    TEST_ASSERT_EQUAL_INT(0, _tcb.rcv_wnd_scale);
+    TEST_ASSERT_EQUAL_INT(PEER_WND, _tcb.snd_wnd);
+
+    pkt = _build_ack();
+    TEST_ASSERT_EQUAL_INT(UINT16_MAX,
+                          _window(gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP)));
+    gnrc_pktbuf_release(pkt);
+}
+
+/*
+ * Receives two segments out of order with a gap between them, fills that gap
+ * and then the gap before the first one.
+ * Expected result: the segments are kept and reported in SACK blocks, the
+ * most recently received first, adjacent segments in one block. Filling the
+ * first gap moves all kept data into the receive buffer in order
+ */
+static void test_ooo__sack_and_merge(void)
+{
+    uint32_t edges[2 * 4];
+    /* one byte more than expected, to detect excess data */
+    uint8_t data[(4 * SEG_LEN) + 1];
+
+    _establish();
+    _rcvd(PEER_SEQ + 10, MSK_ACK, NULL, 0, SEG_LEN);
+    TEST_ASSERT_EQUAL_INT(PEER_SEQ, _tcb.rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(1, _sack_blocks(edges));
+    TEST_ASSERT_EQUAL_INT(10, edges[0]);
+    TEST_ASSERT_EQUAL_INT(20, edges[1]);
+
+    _rcvd(PEER_SEQ + 30, MSK_ACK, NULL, 0, SEG_LEN);
+    TEST_ASSERT_EQUAL_INT(PEER_SEQ, _tcb.rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(2, _sack_blocks(edges));
+    TEST_ASSERT_EQUAL_INT(30, edges[0]);
+    TEST_ASSERT_EQUAL_INT(40, edges[1]);
+    TEST_ASSERT_EQUAL_INT(10, edges[2]);
+    TEST_ASSERT_EQUAL_INT(20, edges[3]);
+
+    _rcvd(PEER_SEQ + 20, MSK_ACK, NULL, 0, SEG_LEN);
+    TEST_ASSERT_EQUAL_INT(PEER_SEQ, _tcb.rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(1, _sack_blocks(edges));
+    TEST_ASSERT_EQUAL_INT(10, edges[0]);
+    TEST_ASSERT_EQUAL_INT(40, edges[1]);
+
+    _rcvd(PEER_SEQ, MSK_ACK, NULL, 0, SEG_LEN);
+    TEST_ASSERT_EQUAL_INT(PEER_SEQ + 40, _tcb.rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(0, _sack_blocks(edges));
+    TEST_ASSERT_EQUAL_INT(4 * SEG_LEN, ringbuffer_get(&_tcb.rcv_buf, (char *)data,
+                                                      sizeof(data)));
+    for (unsigned i = 0; i < (4 * SEG_LEN); i++) {
+        TEST_ASSERT_EQUAL_INT(i, data[i]);
+    }
+}
+
+/*
+ * Keeps two segments received out of order, then closes the connection
+ * after the peer did.
+ * Expected result: the kept segments are released once the connection is
+ * closed
+ */
+static void test_ooo__release_on_close(void)
+{
+    _establish();
+    _rcvd(PEER_SEQ + 10, MSK_ACK, NULL, 0, SEG_LEN);
+    _rcvd(PEER_SEQ + 30, MSK_ACK, NULL, 0, SEG_LEN);
+    _rcvd(PEER_SEQ, MSK_FIN_ACK, NULL, 0, 0);
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_CLOSE_WAIT, _tcb.state);
+    _gnrc_tcp_fsm(&_tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_LAST_ACK, _tcb.state);
+    TEST_ASSERT(!gnrc_pktbuf_is_empty());
+    _rcvd(PEER_SEQ + 1, MSK_ACK, NULL, 0, 0);
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_CLOSED, _tcb.state);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+/*
+ * Keeps two segments received out of order, then the peer resets the
+ * connection.
+ * Expected result: the kept segments are released once the connection is
+ * closed
+ */
+static void test_ooo__release_on_rst(void)
+{
+    _establish();
+    _rcvd(PEER_SEQ + 10, MSK_ACK, NULL, 0, SEG_LEN);
+    _rcvd(PEER_SEQ + 30, MSK_ACK, NULL, 0, SEG_LEN);
+    TEST_ASSERT(!gnrc_pktbuf_is_empty());
+    _rcvd(PEER_SEQ, MSK_RST, NULL, 0, 0);
+    TEST_ASSERT_EQUAL_INT(FSM_STATE_CLOSED, _tcb.state);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static Test *tests_gnrc_tcp_ws_sack(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ws_sack__accepted),
+        new_TestFixture(test_ws_sack__not_offered),
+        new_TestFixture(test_ws_sack__small_buffer),
+        new_TestFixture(test_ws_sack__active),
+        new_TestFixture(test_ooo__sack_and_merge),
+        new_TestFixture(test_ooo__release_on_close),
+        new_TestFixture(test_ooo__release_on_rst),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, tear_down, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_tcp_ws_sack());
+    TESTS_END();
+
+    return 0;
+}
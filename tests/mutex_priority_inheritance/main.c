@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for mutex priority inheritance with several
+ *              mutexes unlocked out of order
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+
+static char _stacks[2][THREAD_STACKSIZE_DEFAULT];
+static mutex_t _m1 = MUTEX_INIT;
+static mutex_t _m2 = MUTEX_INIT;
+static unsigned _failures;
+
+static void *_waiter(void *arg)
+{
+    mutex_t *mutex = arg;
+
+    mutex_lock(mutex);
+    mutex_unlock(mutex);
+
+    return NULL;
+}
+
+static void _start_waiter(unsigned idx, uint8_t prio, mutex_t *mutex)
+{
+    /* the waiter preempts main right away and blocks on mutex */
+    thread_create(_stacks[idx], sizeof(_stacks[idx]), prio,
+                  THREAD_CREATE_STACKTEST, _waiter, mutex, "waiter");
+}
+
+static void _check(const char *step, uint8_t expected)
+{
+    uint8_t prio = thread_get_active()->priority;
+
+    printf("%s: prio %u, expected %u\n", step, (unsigned)prio,
+           (unsigned)expected);
+    if (prio != expected) {
+        _failures++;
+    }
+}
+
+int main(void)
+{
+    puts("Test: M2 locked while boosted by a waiter on M1, M1 unlocked first");
+
+    mutex_lock(&_m1);
+    _start_waiter(0, THREAD_PRIORITY_MAIN - 1, &_m1);
+    _check("waiter on M1", THREAD_PRIORITY_MAIN - 1);
+    mutex_lock(&_m2);
+    mutex_unlock(&_m1);
+    _check("unlocked M1", THREAD_PRIORITY_MAIN);
+    mutex_unlock(&_m2);
+    _check("unlocked M2", THREAD_PRIORITY_MAIN);
+
+    puts("Test: waiters on M1 and M2, M2 unlocked first");
+
+    mutex_lock(&_m1);
+    mutex_lock(&_m2);
+    _start_waiter(0, THREAD_PRIORITY_MAIN - 1, &_m1);
+    _check("waiter on M1", THREAD_PRIORITY_MAIN - 1);
+    _start_waiter(1, THREAD_PRIORITY_MAIN - 2, &_m2);
+    _check("waiter on M2", THREAD_PRIORITY_MAIN - 2);
+    mutex_unlock(&_m2);
+    _check("unlocked M2", THREAD_PRIORITY_MAIN - 1);
+    mutex_unlock(&_m1);
+    _check("unlocked M1", THREAD_PRIORITY_MAIN);
+
+    puts((_failures) ? "TEST FAILED" : "TEST PASSED");
+
+    return 0;
+}
@@ -17,6 +17,7 @@ def testfunc(child):
     child.expect(r'        RX packets \d+  bytes \d+')
     child.expect(r'        TX packets \d+ \(Multicast: \d+\)  bytes \d+')
     child.expect(r'        TX succeeded \d+ errors \d+')
+    child.expect(r'        TX copied bytes \d+ \(\d+ per packet\)')
 
 
 if __name__ == "__main__":
@@ -85,18 +85,10 @@ static void _sched_statistics_trigger(void)
     sched_statistics_cb(thread_getpid(), thread_getpid());
 }
 
-static xtimer_ticks32_t _sched_ticks(void)
+static uint32_t _sched_us(void)
 {
     _sched_statistics_trigger();
-    xtimer_ticks32_t runtime_ticks = {
-        .ticks32 = sched_pidlist[thread_getpid()].runtime_ticks
-    };
-    return runtime_ticks;
-}
-
-static uint32_t _xtimer_diff_usec(xtimer_ticks32_t stop, xtimer_ticks32_t start)
-{
-    return xtimer_usec_from_ticks(xtimer_diff(stop, start));
+    return sched_pidlist[thread_getpid()].runtime_us;
 }
 
 void print_bytes(char* title, uint8_t* data, size_t len)
@@ -277,7 +269,7 @@ int cmd_bench(int argc, char **argv)
     (void)argv;
 
     uint32_t start, stop;
-    xtimer_ticks32_t sched_start, sched_stop;
+    uint32_t sched_start, sched_stop;
     uint32_t sched_diff_us;
     uint32_t sum = 0;
     uint32_t sched_sum = 0;
@@ -303,217 +295,217 @@ int cmd_bench(int argc, char **argv)
     puts("### Test\t\t\t\tTransfer time\tuser time\n");
 
     /* 1 - write 1000 times 1 byte */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         in = spi_transfer_byte(spiconf.dev, spiconf.cs, false, out);
         (void)in;
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf(" 1 - write %i times %i byte:", BENCH_REDOS, 1);
     printf("\t\t\t%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
     /* 2 - write 1000 times 2 byte */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         spi_transfer_bytes(spiconf.dev, spiconf.cs, false,
                            bench_wbuf, NULL, BENCH_SMALL);
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf(" 2 - write %i times %i byte:", BENCH_REDOS, BENCH_SMALL);
     printf("\t\t\t%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
     /* 3 - write 1000 times 100 byte */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         spi_transfer_bytes(spiconf.dev, spiconf.cs, false,
                            bench_wbuf, NULL, BENCH_LARGE);
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf(" 3 - write %i times %i byte:", BENCH_REDOS, BENCH_LARGE);
     printf("\t\t%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
     /* 4 - write 1000 times 1 byte to register */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         in = spi_transfer_reg(spiconf.dev, spiconf.cs, BENCH_REGADDR, out);
         (void)in;
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf(" 4 - write %i times %i byte to register:", BENCH_REDOS, 1);
     printf("\t%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
     /* 5 - write 1000 times 2 byte to register */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         spi_transfer_regs(spiconf.dev, spiconf.cs, BENCH_REGADDR,
                           bench_wbuf, NULL, BENCH_SMALL);
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf(" 5 - write %i times %i byte to register:", BENCH_REDOS, BENCH_SMALL);
     printf("\t%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
     /* 6 - write 1000 times 100 byte to register */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         spi_transfer_regs(spiconf.dev, spiconf.cs, BENCH_REGADDR,
                           bench_wbuf, NULL, BENCH_LARGE);
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf(" 6 - write %i times %i byte to register:", BENCH_REDOS, BENCH_LARGE);
     printf("\t%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
     /* 7 - read 1000 times 2 byte */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         spi_transfer_bytes(spiconf.dev, spiconf.cs, false,
                            NULL, bench_rbuf, BENCH_SMALL);
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf(" 7 - read %i times %i byte:", BENCH_REDOS, BENCH_SMALL);
     printf("\t\t\t%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
     /* 8 - read 1000 times 100 byte */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         spi_transfer_bytes(spiconf.dev, spiconf.cs, false,
                            NULL, bench_rbuf, BENCH_LARGE);
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf(" 8 - read %i times %i byte:", BENCH_REDOS, BENCH_LARGE);
     printf("\t\t%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
     /* 9 - read 1000 times 2 byte from register */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         spi_transfer_regs(spiconf.dev, spiconf.cs, BENCH_REGADDR,
                           NULL, bench_rbuf, BENCH_SMALL);
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf(" 9 - read %i times %i byte from register:", BENCH_REDOS, BENCH_SMALL);
     printf("\t%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
     /* 10 - read 1000 times 100 byte from register */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         spi_transfer_regs(spiconf.dev, spiconf.cs, BENCH_REGADDR,
                           NULL, bench_rbuf, BENCH_LARGE);
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf("10 - read %i times %i byte from register:", BENCH_REDOS, BENCH_LARGE);
     printf("\t%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
     /* 11 - transfer 1000 times 2 byte */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         spi_transfer_bytes(spiconf.dev, spiconf.cs, false,
                            bench_wbuf, bench_rbuf, BENCH_SMALL);
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf("11 - transfer %i times %i byte:", BENCH_REDOS, BENCH_SMALL);
     printf("\t\t%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
     /* 12 - transfer 1000 times 100 byte */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         spi_transfer_bytes(spiconf.dev, spiconf.cs, false,
                            bench_wbuf, bench_rbuf, BENCH_LARGE);
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf("12 - transfer %i times %i byte:", BENCH_REDOS, BENCH_LARGE);
     printf("\t\t%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
     /* 13 - transfer 1000 times 2 byte from/to register */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         spi_transfer_regs(spiconf.dev, spiconf.cs, BENCH_REGADDR,
                           bench_wbuf, bench_rbuf, BENCH_SMALL);
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf("13 - transfer %i times %i byte to register:", BENCH_REDOS, BENCH_SMALL);
     printf("\t%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
     /* 14 - transfer 1000 times 100 byte from/to register */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         spi_transfer_regs(spiconf.dev, spiconf.cs, BENCH_REGADDR,
                           bench_wbuf, bench_rbuf, BENCH_LARGE);
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf("14 - transfer %i times %i byte to register:", BENCH_REDOS, BENCH_LARGE);
     printf("%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
     /* 15 - release & acquire the bus 1000 times */
-    sched_start = _sched_ticks();
+    sched_start = _sched_us();
     start = xtimer_now_usec();
     for (int i = 0; i < BENCH_REDOS; i++) {
         spi_release(spiconf.dev);
@@ -523,8 +515,8 @@ int cmd_bench(int argc, char **argv)
         }
     }
     stop = xtimer_now_usec();
-    sched_stop = _sched_ticks();
-    sched_diff_us = _xtimer_diff_usec(sched_stop, sched_start);
+    sched_stop = _sched_us();
+    sched_diff_us = sched_stop - sched_start;
     printf("15 - acquire/release %i times:\t\t", BENCH_REDOS);
     printf("%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
     sum += (stop - start);
@@ -31,6 +31,18 @@ PS_EXPECTED = (
     (r'\t    | SUM                  |            |     | \d+  \(\d+\)')
 )
 
+PS_JSON_STATS = (r'"runtime_us" : \d+, "switches" : \d+, '
+                 r'"voluntary" : \d+, "involuntary" : \d+, '
+                 r'"latency_max_us" : \d+, "latency_hist" : \[[\d, ]+\] \}')
+
+PS_JSON_EXPECTED = (
+    r'\{ "isr" : \{ "runtime_us" : \d+, "count" : \d+ \} \}',
+    (r'\{ "pid" : 1, "name" : "idle", "state" : "pending", "priority" : 15, '
+     r'"stack_size" : \d+, "stack_free" : \d+, ' + PS_JSON_STATS),
+    (r'\{ "pid" : 2, "name" : "main", "state" : "running", "priority" : 7, '
+     r'"stack_size" : \d+, "stack_free" : \d+, ' + PS_JSON_STATS),
+)
+
 
 def _check_startup(child):
     for i in range(5):
@@ -57,10 +69,18 @@ def _check_ps(child):
     child.expect_exact('>')
 
 
+def _check_ps_json(child):
+    child.sendline('ps json')
+    for line in PS_JSON_EXPECTED:
+        child.expect(line)
+    child.expect_exact('>')
+
+
 def testfunc(child):
     _check_startup(child)
     _check_help(child)
     _check_ps(child)
+    _check_ps_json(child)
 
 
 if __name__ == "__main__":
@@ -331,6 +331,31 @@ static void test_clist_count(void)
     }
 }
 
+static void test_clist_exactly_one(void)
+{
+    TEST_ASSERT(!clist_exactly_one(&test_clist));
+    clist_rpush(&test_clist, &tests_clist_buf[0]);
+    TEST_ASSERT(clist_exactly_one(&test_clist));
+    clist_rpush(&test_clist, &tests_clist_buf[1]);
+    TEST_ASSERT(!clist_exactly_one(&test_clist));
+    clist_lpop(&test_clist);
+    TEST_ASSERT(clist_exactly_one(&test_clist));
+}
+
+static void test_clist_more_than_one(void)
+{
+    TEST_ASSERT(!clist_more_than_one(&test_clist));
+    clist_rpush(&test_clist, &tests_clist_buf[0]);
+    TEST_ASSERT(!clist_more_than_one(&test_clist));
+    clist_rpush(&test_clist, &tests_clist_buf[1]);
+    TEST_ASSERT(clist_more_than_one(&test_clist));
+    clist_rpush(&test_clist, &tests_clist_buf[2]);
+    TEST_ASSERT(clist_more_than_one(&test_clist));
+    clist_lpop(&test_clist);
+    clist_lpop(&test_clist);
+    TEST_ASSERT(!clist_more_than_one(&test_clist));
+}
+
 Test *tests_core_clist_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -349,6 +374,8 @@ Test *tests_core_clist_tests(void)
         new_TestFixture(test_clist_sort_empty),
         new_TestFixture(test_clist_sort),
         new_TestFixture(test_clist_count),
+        new_TestFixture(test_clist_exactly_one),
+        new_TestFixture(test_clist_more_than_one),
     };
 
     EMB_UNIT_TESTCALLER(core_clist_tests, set_up, NULL,
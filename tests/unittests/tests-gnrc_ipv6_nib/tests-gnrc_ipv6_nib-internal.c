@@ -552,6 +552,38 @@ static void test_nib_nc_set_reachable__success(void)
     /* TODO: check NIB's event timer */
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH) && IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+/*
+ * Creates CONFIG_GNRC_IPV6_NIB_NUMOF neighbor cache entries with different IP
+ * addresses, removes the third, sets the first reachable and adds two more.
+ * Expected result: the first entry should be cached out last, i.e. the second
+ * and the fourth entry should be replaced
+ */
+static void test_nib_nc_set_reachable__cache_out_order(void)
+{
+    _nib_onl_entry_t *nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+
+    for (int i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_nc_add(&addr, IFACE,
+                                                     GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+        addr.u64[1].u64++;
+    }
+    _nib_nc_remove(nodes[2]);
+    _nib_nc_set_reachable(nodes[0]);
+    /* fills the entry freed by removing the third one */
+    TEST_ASSERT(nodes[2] == _nib_nc_add(&addr, IFACE,
+                                        GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE));
+    addr.u64[1].u64++;
+    TEST_ASSERT(nodes[1] == _nib_nc_add(&addr, IFACE,
+                                        GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE));
+    addr.u64[1].u64++;
+    TEST_ASSERT(nodes[3] == _nib_nc_add(&addr, IFACE,
+                                        GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE));
+}
+#endif
+
 /*
  * Creates a neighbor cache entry, sets another flag, and tries to remove it.
  * Expected result: The entry should still exist
@@ -2031,6 +2063,9 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_nc_remove__uncleared),
         new_TestFixture(test_nib_nc_remove__cleared),
         new_TestFixture(test_nib_nc_set_reachable__success),
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH) && IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+        new_TestFixture(test_nib_nc_set_reachable__cache_out_order),
+#endif
         new_TestFixture(test_nib_drl_add__no_space_left_diff_addr),
         new_TestFixture(test_nib_drl_add__no_space_left_diff_iface),
         new_TestFixture(test_nib_drl_add__no_space_left_diff_addr_iface),
@@ -198,6 +198,33 @@ static void test_nib_nc_del__success(void)
     TEST_ASSERT(!gnrc_ipv6_nib_nc_iter(0, &iter_state, &nce));
 }
 
+/*
+ * Reads the generation of the NIB, then creates a neighbor cache entry, reads
+ * the neighbor cache and deletes the entry.
+ * Expected result: the generation advances with both changes, but not when the
+ * neighbor cache is only read
+ */
+static void test_nib_nc_gen(void)
+{
+    static const ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                             { .u64 = TEST_UINT64 } } };
+    static const uint8_t l2addr[] = L2ADDR;
+    gnrc_ipv6_nib_nc_t nce;
+    void *iter_state = NULL;
+    uint32_t gen = gnrc_ipv6_nib_gen();
+
+    TEST_ASSERT_EQUAL_INT(gen, gnrc_ipv6_nib_gen());
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&addr, IFACE, l2addr,
+                                                  sizeof(l2addr)));
+    TEST_ASSERT(gen != gnrc_ipv6_nib_gen());
+    gen = gnrc_ipv6_nib_gen();
+    TEST_ASSERT(gnrc_ipv6_nib_nc_iter(0, &iter_state, &nce));
+    TEST_ASSERT(!gnrc_ipv6_nib_nc_iter(0, &iter_state, &nce));
+    TEST_ASSERT_EQUAL_INT(gen, gnrc_ipv6_nib_gen());
+    gnrc_ipv6_nib_nc_del(&addr, IFACE);
+    TEST_ASSERT(gen != gnrc_ipv6_nib_gen());
+}
+
 /*
  * Creates a non-manual neighbor cache entry (as the NIB would create it on an
  * incoming NDP packet), sets it to UNREACHABLE and then calls
@@ -314,6 +341,7 @@ Test *tests_gnrc_ipv6_nib_nc_tests(void)
         new_TestFixture(test_nib_nc_set__success_duplicate),
         new_TestFixture(test_nib_nc_del__unknown),
         new_TestFixture(test_nib_nc_del__success),
+        new_TestFixture(test_nib_nc_gen),
         new_TestFixture(test_nib_nc_mark_reachable__not_in_neighbor_cache),
         new_TestFixture(test_nib_nc_mark_reachable__unmanaged),
         new_TestFixture(test_nib_nc_mark_reachable__success),
@@ -165,6 +165,48 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+/* byte-wise reference implementation of inet_csum_slice() */
+static uint16_t _csum_bytewise(uint16_t sum, const uint8_t *buf, uint16_t len,
+                               size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < len; i++) {
+        if ((accum_len + i) & 1) {
+            csum += buf[i];
+        }
+        else {
+            csum += (uint16_t)(buf[i] << 8);
+        }
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void test_inet_csum__offsets_and_lengths(void)
+{
+    /* 0xff-heavy data, so the sum wraps often */
+    uint8_t data[48];
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = (i % 3) ? 0xff : (uint8_t)(i * 37);
+    }
+    /* covers every alignment of the buffer and every remainder of the length
+     * with respect to the word the checksum is accumulated in */
+    for (unsigned offset = 0; offset < 8; offset++) {
+        for (unsigned len = 0; len <= (sizeof(data) - offset); len++) {
+            for (unsigned accum_len = 0; accum_len < 2; accum_len++) {
+                TEST_ASSERT_EQUAL_INT(
+                    _csum_bytewise(0xfffe, &data[offset], len, accum_len),
+                    inet_csum_slice(0xfffe, &data[offset], len, accum_len)
+                );
+            }
+        }
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +218,7 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__offsets_and_lengths),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
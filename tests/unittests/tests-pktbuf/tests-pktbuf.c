@@ -202,6 +202,7 @@ static void test_pktbuf_add__memfull(void)
 }
 #endif
 
+#ifndef MODULE_GNRC_PKTBUF_SLAB   /* needs more large blocks than the default */
 static void test_pktbuf_add__success(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_prev = NULL;
@@ -225,6 +226,7 @@ static void test_pktbuf_add__success(void)
     }
     TEST_ASSERT(gnrc_pktbuf_is_sane());
 }
+#endif
 
 static void test_pktbuf_add__packed_struct(void)
 {
@@ -245,7 +247,8 @@ static void test_pktbuf_add__packed_struct(void)
     TEST_ASSERT_EQUAL_INT(data.s64, data_cpy->s64);
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC   /* alignment-handling left to malloc, so no certainty here */
+/* alignment-handling left to malloc, so no certainty here, slab reuses blocks */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
 static void test_pktbuf_add__unaligned_in_aligned_hole(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_TEST);
@@ -653,7 +656,7 @@ static void test_pktbuf_realloc_data__success3(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
 static void test_pktbuf_merge_data__memfull(void)
 {
     gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, (CONFIG_GNRC_PKTBUF_SIZE / 4),
@@ -813,7 +816,7 @@ static void test_pktbuf_start_write__pkt_users_2(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
 static void test_pktbuf_reverse_snips__too_full(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_next, *pkt_huge;
@@ -852,6 +855,86 @@ static void test_pktbuf_reverse_snips__success(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+static void test_pktbuf_loan__commit(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_loan(sizeof(TEST_STRING64), 14);
+    gnrc_pktsnip_t *hdr;
+    void *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING64), pkt->size);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_UNDEF, pkt->type);
+    data = pkt->data;
+    memcpy(data, TEST_STRING64, sizeof(TEST_STRING64));
+    TEST_ASSERT_NULL(gnrc_pktbuf_commit(pkt, 14, 14, GNRC_NETTYPE_TEST));
+    hdr = gnrc_pktbuf_commit(pkt, sizeof(TEST_STRING16), 14,
+                             GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT(pkt->next == hdr);
+    TEST_ASSERT_EQUAL_INT(14, hdr->size);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_TEST, hdr->type);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16) - 14, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64, hdr->data, 14));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64 + 14, pkt->data, pkt->size));
+#ifndef MODULE_GNRC_PKTBUF_MALLOC
+    /* frame was not moved */
+    TEST_ASSERT(hdr->data == data);
+    TEST_ASSERT(pkt->data == (uint8_t *)data + 14);
+#endif
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+static void test_pktbuf_slab__mark_shares_block(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING16,
+                                          sizeof(TEST_STRING16),
+                                          GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *hdr;
+    void *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    hdr = gnrc_pktbuf_mark(pkt, 4, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    /* data is split without copying */
+    TEST_ASSERT(hdr->data == data);
+    TEST_ASSERT(pkt->data == (uint8_t *)data + 4);
+    /* block stays allocated as long as one of the snips references it */
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(!gnrc_pktbuf_is_empty());
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16 + 4, pkt->data);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab__size_class_fallback(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+
+    /* use up all small blocks */
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF; i++) {
+        pkt = gnrc_pktbuf_add(pkt, NULL, 1, GNRC_NETTYPE_TEST);
+        TEST_ASSERT_NOT_NULL(pkt);
+    }
+    /* small data is then put into a larger block */
+    gnrc_pktsnip_t *small = gnrc_pktbuf_add(NULL, TEST_STRING8,
+                                            sizeof(TEST_STRING8),
+                                            GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(small);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING8, small->data);
+    gnrc_pktbuf_release(small);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+
 Test *tests_pktbuf_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -866,9 +949,11 @@ Test *tests_pktbuf_tests(void)
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
         new_TestFixture(test_pktbuf_add__memfull),
 #endif
+#ifndef MODULE_GNRC_PKTBUF_SLAB
         new_TestFixture(test_pktbuf_add__success),
+#endif
         new_TestFixture(test_pktbuf_add__packed_struct),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
 #endif
         new_TestFixture(test_pktbuf_add__0_sized_release),
@@ -892,7 +977,7 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_realloc_data__success),
         new_TestFixture(test_pktbuf_realloc_data__success2),
         new_TestFixture(test_pktbuf_realloc_data__success3),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_merge_data__memfull),
 #endif /* MODULE_GNRC_PKTBUF_MALLOC */
         new_TestFixture(test_pktbuf_merge_data__success1),
@@ -906,10 +991,15 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_start_write__NULL),
         new_TestFixture(test_pktbuf_start_write__pkt_users_1),
         new_TestFixture(test_pktbuf_start_write__pkt_users_2),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_reverse_snips__too_full),
 #endif /* MODULE_GNRC_PKTBUF_MALLOC */
         new_TestFixture(test_pktbuf_reverse_snips__success),
+        new_TestFixture(test_pktbuf_loan__commit),
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+        new_TestFixture(test_pktbuf_slab__mark_shares_block),
+        new_TestFixture(test_pktbuf_slab__size_class_fallback),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(gnrc_pktbuf_tests, set_up, NULL, fixtures);
@@ -19,6 +19,7 @@
 
 #include "net/ipv6/addr.h"
 #include "net/gnrc/sixlowpan/ctx.h"
+#include "xtimer.h"
 
 #include "unittests-constants.h"
 #include "tests-sixlowpan_ctx.h"
@@ -37,6 +38,8 @@
             0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f \
         } \
     }
+/* shares the first 80 bits with DEFAULT_TEST_PREFIX */
+#define LONG_TEST_PREFIX_LEN  (80)
 #define WRONG_TEST_PREFIX   { { \
             0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x05, \
             0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f \
@@ -195,6 +198,136 @@ static void test_sixlowpan_ctx_remove(void)
     TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_addr(&addr));
 }
 
+static void test_sixlowpan_ctx_lookup_addr__longest_prefix(void)
+{
+    ipv6_addr_t addr1 = DEFAULT_TEST_PREFIX;
+    ipv6_addr_t addr2 = OTHER_TEST_PREFIX;
+    gnrc_sixlowpan_ctx_t *ctx;
+
+    /* the longer prefix has the higher ID, so the ID does not decide */
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(DEFAULT_TEST_ID, &addr1,
+                                                   DEFAULT_TEST_PREFIX_LEN,
+                                                   TEST_UINT16, true));
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(OTHER_TEST_ID, &addr1,
+                                                   LONG_TEST_PREFIX_LEN,
+                                                   TEST_UINT16, true));
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_addr(&addr1)));
+    TEST_ASSERT_EQUAL_INT(GNRC_SIXLOWPAN_CTX_FLAGS_COMP | OTHER_TEST_ID,
+                          ctx->flags_id);
+    TEST_ASSERT_EQUAL_INT(LONG_TEST_PREFIX_LEN, ctx->prefix_len);
+    /* only matched by the shorter prefix */
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_addr(&addr2)));
+    TEST_ASSERT_EQUAL_INT(GNRC_SIXLOWPAN_CTX_FLAGS_COMP | DEFAULT_TEST_ID,
+                          ctx->flags_id);
+    TEST_ASSERT_EQUAL_INT(DEFAULT_TEST_PREFIX_LEN, ctx->prefix_len);
+}
+
+static void test_sixlowpan_ctx_lookup_addr__same_prefix(void)
+{
+    ipv6_addr_t addr = OTHER_TEST_PREFIX;
+    gnrc_sixlowpan_ctx_t *ctx;
+
+    /* OTHER_TEST_PREFIX stored as /63 and /64 is the same prefix, so the
+     * lower ID is preferred even though its prefix is shorter */
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(OTHER_TEST_ID, &addr,
+                                                   DEFAULT_TEST_PREFIX_LEN + 1,
+                                                   TEST_UINT16, true));
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(DEFAULT_TEST_ID, &addr,
+                                                   DEFAULT_TEST_PREFIX_LEN,
+                                                   TEST_UINT16, true));
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_addr(&addr)));
+    TEST_ASSERT_EQUAL_INT(GNRC_SIXLOWPAN_CTX_FLAGS_COMP | DEFAULT_TEST_ID,
+                          ctx->flags_id);
+    /* the same goes for equally long prefixes */
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(OTHER_TEST_ID, &addr,
+                                                   DEFAULT_TEST_PREFIX_LEN,
+                                                   TEST_UINT16, true));
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_addr(&addr)));
+    TEST_ASSERT_EQUAL_INT(GNRC_SIXLOWPAN_CTX_FLAGS_COMP | DEFAULT_TEST_ID,
+                          ctx->flags_id);
+}
+
+static void test_sixlowpan_ctx_lookup_addr__removed(void)
+{
+    ipv6_addr_t addr1 = DEFAULT_TEST_PREFIX;
+    ipv6_addr_t addr2 = OTHER_TEST_PREFIX;
+    gnrc_sixlowpan_ctx_t *ctx;
+
+    /* best match for addr1 */
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(OTHER_TEST_ID, &addr1,
+                                                   LONG_TEST_PREFIX_LEN,
+                                                   TEST_UINT16, true));
+    /* preferred over the same prefix with a higher ID for addr2 */
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(DEFAULT_TEST_ID, &addr2,
+                                                   DEFAULT_TEST_PREFIX_LEN,
+                                                   TEST_UINT16, true));
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(DEFAULT_TEST_ID + 1, &addr2,
+                                                   DEFAULT_TEST_PREFIX_LEN,
+                                                   TEST_UINT16, true));
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_addr(&addr1)));
+    TEST_ASSERT_EQUAL_INT(GNRC_SIXLOWPAN_CTX_FLAGS_COMP | OTHER_TEST_ID,
+                          ctx->flags_id);
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_addr(&addr2)));
+    TEST_ASSERT_EQUAL_INT(GNRC_SIXLOWPAN_CTX_FLAGS_COMP | DEFAULT_TEST_ID,
+                          ctx->flags_id);
+    gnrc_sixlowpan_ctx_remove(OTHER_TEST_ID);
+    gnrc_sixlowpan_ctx_remove(DEFAULT_TEST_ID);
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_addr(&addr1)));
+    TEST_ASSERT_EQUAL_INT(GNRC_SIXLOWPAN_CTX_FLAGS_COMP | (DEFAULT_TEST_ID + 1),
+                          ctx->flags_id);
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_addr(&addr2)));
+    TEST_ASSERT_EQUAL_INT(GNRC_SIXLOWPAN_CTX_FLAGS_COMP | (DEFAULT_TEST_ID + 1),
+                          ctx->flags_id);
+    gnrc_sixlowpan_ctx_remove(DEFAULT_TEST_ID + 1);
+    TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_addr(&addr1));
+}
+
+static void test_sixlowpan_ctx_update__shorter_prefix_len(void)
+{
+    static const ipv6_addr_t exp = { .u8 = {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06,
+        }
+    };
+    ipv6_addr_t addr1 = DEFAULT_TEST_PREFIX;
+    ipv6_addr_t addr2 = OTHER_TEST_PREFIX;
+    gnrc_sixlowpan_ctx_t *ctx;
+
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(DEFAULT_TEST_ID, &addr1,
+                                                   LONG_TEST_PREFIX_LEN,
+                                                   TEST_UINT16, true));
+    TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_addr(&addr2));
+    /* same prefix, only the length changes */
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_update(DEFAULT_TEST_ID,
+                                                          &addr1,
+                                                          DEFAULT_TEST_PREFIX_LEN,
+                                                          TEST_UINT16, true)));
+    TEST_ASSERT_EQUAL_INT(DEFAULT_TEST_PREFIX_LEN, ctx->prefix_len);
+    TEST_ASSERT(ipv6_addr_equal(&exp, &ctx->prefix));
+    TEST_ASSERT(ctx == gnrc_sixlowpan_ctx_lookup_addr(&addr2));
+}
+
+static void test_sixlowpan_ctx_update__ltime_expired(void)
+{
+    ipv6_addr_t addr = DEFAULT_TEST_PREFIX;
+    gnrc_sixlowpan_ctx_t *ctx;
+
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(DEFAULT_TEST_ID, &addr,
+                                                   DEFAULT_TEST_PREFIX_LEN,
+                                                   2, true));
+    xtimer_usleep(GNRC_SIXLOWPAN_CTX_LTIME_TICK_US +
+                  (GNRC_SIXLOWPAN_CTX_LTIME_TICK_US / 2));
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_id(DEFAULT_TEST_ID)));
+    TEST_ASSERT_EQUAL_INT(1, ctx->ltime);
+    TEST_ASSERT_EQUAL_INT(GNRC_SIXLOWPAN_CTX_FLAGS_COMP | DEFAULT_TEST_ID,
+                          ctx->flags_id);
+    xtimer_usleep(GNRC_SIXLOWPAN_CTX_LTIME_TICK_US);
+    /* still valid for decompression, but not for compression */
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_id(DEFAULT_TEST_ID)));
+    TEST_ASSERT_EQUAL_INT(0, ctx->ltime);
+    TEST_ASSERT_EQUAL_INT(DEFAULT_TEST_ID, ctx->flags_id);
+    TEST_ASSERT(ctx == gnrc_sixlowpan_ctx_lookup_addr(&addr));
+}
+
 Test *tests_sixlowpan_ctx_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -203,10 +336,15 @@ Test *tests_sixlowpan_ctx_tests(void)
         new_TestFixture(test_sixlowpan_ctx_update__wrong_prefix_len),
         new_TestFixture(test_sixlowpan_ctx_update__success),
         new_TestFixture(test_sixlowpan_ctx_update__ltime0),
+        new_TestFixture(test_sixlowpan_ctx_update__shorter_prefix_len),
+        new_TestFixture(test_sixlowpan_ctx_update__ltime_expired),
         new_TestFixture(test_sixlowpan_ctx_lookup_addr__empty),
         new_TestFixture(test_sixlowpan_ctx_lookup_addr__same_addr),
         new_TestFixture(test_sixlowpan_ctx_lookup_addr__other_addr_same_prefix),
         new_TestFixture(test_sixlowpan_ctx_lookup_addr__other_addr_other_prefix),
+        new_TestFixture(test_sixlowpan_ctx_lookup_addr__longest_prefix),
+        new_TestFixture(test_sixlowpan_ctx_lookup_addr__same_prefix),
+        new_TestFixture(test_sixlowpan_ctx_lookup_addr__removed),
         new_TestFixture(test_sixlowpan_ctx_lookup_id__empty),
         new_TestFixture(test_sixlowpan_ctx_lookup_id__wrong_id),
         new_TestFixture(test_sixlowpan_ctx_lookup_id__success),
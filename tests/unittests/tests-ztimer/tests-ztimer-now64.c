@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for ztimer_now64() with ztimer_epoch
+ */
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+/*
+ * Steps the 32 bit counter of a mock clock across several wraparounds, one of
+ * them without reading the time in between, and reads the time right before
+ * and right after a wraparound.
+ * Expected result: ztimer_now64() always returns the exact time and strictly
+ * increases
+ */
+static void test_ztimer_now64_wrap(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 32);
+    /* wraparounds before the first call are not counted */
+    ztimer_mock_jump(&zmock, 0xffffff00ul);
+    uint64_t expected = 0xffffff00ul;
+    uint64_t last = ztimer_now64(z);
+    TEST_ASSERT(last == expected);
+
+    /* wrap while being read in between */
+    ztimer_mock_advance(&zmock, 0x200);
+    expected += 0x200;
+    uint64_t now64 = ztimer_now64(z);
+    TEST_ASSERT(now64 == expected);
+    TEST_ASSERT(now64 > last);
+    last = now64;
+    for (unsigned i = 0; i < 9; i++) {
+        ztimer_mock_advance(&zmock, 0x40000000ul);
+        expected += 0x40000000ul;
+        now64 = ztimer_now64(z);
+        TEST_ASSERT(now64 == expected);
+        TEST_ASSERT(now64 > last);
+        last = now64;
+    }
+
+    /* wrap without reading the time in between, then reading it right
+     * before and right after a wrap */
+    ztimer_mock_advance(&zmock, 0xc0000000ul);
+    ztimer_mock_advance(&zmock, 0xc0000000ul);
+    expected += 0x180000000ull;
+    now64 = ztimer_now64(z);
+    TEST_ASSERT(now64 == expected);
+    TEST_ASSERT(now64 > last);
+    last = now64;
+    ztimer_mock_advance(&zmock, UINT32_MAX - (uint32_t)expected);
+    expected += UINT32_MAX - (uint32_t)expected;
+    now64 = ztimer_now64(z);
+    TEST_ASSERT(now64 == expected);
+    TEST_ASSERT(now64 > last);
+    last = now64;
+    ztimer_mock_advance(&zmock, 1);
+    now64 = ztimer_now64(z);
+    TEST_ASSERT(now64 == expected + 1);
+    TEST_ASSERT(now64 > last);
+    TEST_ASSERT_EQUAL_INT(0, ztimer_now(z));
+}
+
+Test *tests_ztimer_now64_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_now64_wrap),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_now64_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_now64_tests;
+}
+
+/** @} */
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for ztimer_set_with_slack()
+ */
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+#define TIMERS_NUMOF    (32U)
+
+static ztimer_mock_t zmock;
+static ztimer_t timers[TIMERS_NUMOF];
+static uint32_t fired_at[TIMERS_NUMOF];
+static uint32_t fired_pass[TIMERS_NUMOF];
+static unsigned fired;
+
+static void cb_record(void *arg)
+{
+    unsigned i = (ztimer_t *)arg - timers;
+
+    fired_at[i] = ztimer_now(&zmock.super);
+    /* every ztimer_handler() pass ends with setting or cancelling the alarm,
+     * so this tells the passes apart */
+    fired_pass[i] = zmock.calls.set + zmock.calls.cancel;
+    fired++;
+}
+
+static void set_up(void)
+{
+    ztimer_mock_init(&zmock, 32);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        timers[i] = (ztimer_t){ .callback = cb_record, .arg = &timers[i] };
+    }
+    fired = 0;
+}
+
+/*
+ * Sets timers whose slack reaches another timer, in the sorted list, in the
+ * same wheel slot and in the next wheel slot (with `ztimer_wheel`, all of them
+ * are in the sorted list otherwise), and timers whose slack ends just before
+ * another timer.
+ * Expected result: the timers reaching another timer fire together with that
+ * one in the same callback pass, the others fire exactly at their target
+ */
+static void test_ztimer_slack_coalesce(void)
+{
+    ztimer_clock_t *z = &zmock.super;
+
+    /* sorted list */
+    ztimer_set(z, &timers[0], 500);
+    ztimer_set_with_slack(z, &timers[1], 400, 100);
+    ztimer_set_with_slack(z, &timers[2], 450, 49);
+    /* same wheel slot */
+    ztimer_set(z, &timers[3], 10000);
+    ztimer_set_with_slack(z, &timers[4], 9500, 1000);
+    ztimer_set_with_slack(z, &timers[5], 9800, 100);
+    /* next wheel slot */
+    ztimer_set(z, &timers[6], 12300);
+    ztimer_set_with_slack(z, &timers[7], 12000, 400);
+
+    ztimer_mock_advance(&zmock, 20000);
+    TEST_ASSERT_EQUAL_INT(8, fired);
+    TEST_ASSERT_EQUAL_INT(500, fired_at[1]);
+    TEST_ASSERT_EQUAL_INT(fired_pass[0], fired_pass[1]);
+    TEST_ASSERT_EQUAL_INT(450, fired_at[2]);
+    TEST_ASSERT(fired_pass[0] != fired_pass[2]);
+    TEST_ASSERT_EQUAL_INT(10000, fired_at[4]);
+    TEST_ASSERT_EQUAL_INT(fired_pass[3], fired_pass[4]);
+    TEST_ASSERT_EQUAL_INT(9800, fired_at[5]);
+    TEST_ASSERT(fired_pass[3] != fired_pass[5]);
+    TEST_ASSERT_EQUAL_INT(12300, fired_at[7]);
+    TEST_ASSERT_EQUAL_INT(fired_pass[6], fired_pass[7]);
+}
+
+/*
+ * Sets timers with pseudo random offsets and slacks, partly overlapping, while
+ * the clock advances.
+ * Expected result: every timer fires, none before its target and none after
+ * its target plus its slack
+ */
+static void test_ztimer_slack_bounds(void)
+{
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t target[TIMERS_NUMOF];
+    uint32_t slack[TIMERS_NUMOF];
+    uint32_t rand = 12345;
+
+    /* start close to the wrap around of the counter */
+    ztimer_mock_jump(&zmock, 0xfffff000);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        rand = rand * 1103515245 + 12345;
+        uint32_t val = (rand >> 8) % 40000;
+        rand = rand * 1103515245 + 12345;
+        slack[i] = (rand >> 8) % 3000;
+
+        target[i] = ztimer_now(z) + val;
+        ztimer_set_with_slack(z, &timers[i], val, slack[i]);
+        ztimer_mock_advance(&zmock, 300);
+    }
+    ztimer_mock_advance(&zmock, 50000);
+
+    TEST_ASSERT_EQUAL_INT(TIMERS_NUMOF, fired);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        TEST_ASSERT(fired_at[i] - target[i] <= slack[i]);
+    }
+}
+
+Test *tests_ztimer_slack_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_slack_coalesce),
+        new_TestFixture(test_ztimer_slack_bounds),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_slack_tests, set_up, NULL, fixtures);
+
+    return (Test *)&ztimer_slack_tests;
+}
+
+/** @} */
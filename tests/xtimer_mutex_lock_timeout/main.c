@@ -50,6 +50,8 @@ static int cmd_test_xtimer_mutex_lock_timeout_long_locked(int argc,
                                                           char **argv);
 static int cmd_test_xtimer_mutex_lock_timeout_low_prio_thread(int argc,
                                                               char **argv);
+static int cmd_test_xtimer_mutex_lock_timeout_low_prio_owner(int argc,
+                                                             char **argv);
 static int cmd_test_xtimer_mutex_lock_timeout_short_unlocked(int argc,
                                                              char **argv);
 static int cmd_test_xtimer_mutex_lock_timeout_short_locked(int argc,
@@ -67,6 +69,9 @@ static const shell_command_t shell_commands[] = {
     { "mutex_timeout_long_locked_low",
       "lock low-prio-locked-mutex from high-prio-thread (no-spin timeout)",
       cmd_test_xtimer_mutex_lock_timeout_low_prio_thread, },
+    { "mutex_timeout_long_locked_low_owner",
+      "time out on low-prio-locked-mutex from high-prio-thread (no-spin timeout)",
+      cmd_test_xtimer_mutex_lock_timeout_low_prio_owner, },
     { "mutex_timeout_short_unlocked", "unlocked mutex (spin timeout)",
       cmd_test_xtimer_mutex_lock_timeout_short_unlocked, },
     { "mutex_timeout_short_locked", "locked mutex (spin timeout)",
@@ -121,6 +126,36 @@ void *thread_low_prio_test(void *arg)
     msg_send_sched_task_exit(&msg, main_thread_pid);
 }
 
+/**
+ * @brief   priority of thread_low_prio_owner while the main thread waited for
+ *          its mutex
+ */
+static uint8_t owner_prio_while_waited_for;
+
+/**
+ * @brief   thread function for
+ *          cmd_test_xtimer_mutex_lock_timeout_low_prio_owner
+ */
+void *thread_low_prio_owner(void *arg)
+{
+    mutex_t *test_mutex = (mutex_t *)arg;
+    msg_t msg;
+
+    puts("THREAD low prio: start");
+
+    mutex_lock(test_mutex);
+    thread_wakeup(main_thread_pid);
+
+    /* the main thread is now waiting for the mutex */
+    owner_prio_while_waited_for = thread_get_active()->priority;
+    thread_sleep();
+
+    mutex_unlock(test_mutex);
+
+    puts("THREAD low prio: exiting low");
+    msg_send_sched_task_exit(&msg, main_thread_pid);
+}
+
 /**
  * @brief   shell command to test xtimer_mutex_lock_timeout
  *
@@ -266,6 +301,70 @@ static int cmd_test_xtimer_mutex_lock_timeout_low_prio_thread(int argc,
     return 0;
 }
 
+/**
+ * @brief   shell command to test xtimer_mutex_lock_timeout
+ *
+ * This function will create a new thread with lower prio
+ * than the main thread (this function should be called from
+ * the main thread). The new thread will lock a mutex and keep
+ * it locked until woken up. This function (main thread) calls
+ * xtimer_mutex_lock_timeout, which times out. With module
+ * core_mutex_priority_inheritance, the other thread runs at
+ * the priority of the main thread while it waits and has to be
+ * back at its own priority once the main thread gave up.
+ *
+ * @param[in] argc  Number of arguments
+ * @param[in] argv  Array of arguments
+ *
+ * @return 0 always
+ */
+static int cmd_test_xtimer_mutex_lock_timeout_low_prio_owner(int argc,
+                                                             char **argv)
+{
+    (void)argc;
+    (void)argv;
+    puts("starting test: xtimer mutex lock timeout with low prio owner");
+    mutex_t test_mutex = MUTEX_INIT;
+    main_thread_pid = thread_getpid();
+    uint8_t waiter_prio = thread_get_active()->priority;
+    uint8_t owner_prio = THREAD_PRIORITY_MAIN + 1;
+    kernel_pid_t test_thread = thread_create(t_stack, sizeof(t_stack),
+                                             owner_prio,
+                                             THREAD_CREATE_STACKTEST,
+                                             thread_low_prio_owner,
+                                             (void *)&test_mutex,
+                                             "thread_low_prio_owner");
+
+    thread_sleep();
+
+    puts("MAIN THREAD: calling xtimer_mutex_lock_timeout");
+
+    if (xtimer_mutex_lock_timeout(&test_mutex, LONG_MUTEX_TIMEOUT) == 0) {
+        puts("Error: mutex taken");
+    }
+    else if (IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) &&
+             (owner_prio_while_waited_for != waiter_prio)) {
+        puts("error: owner did not inherit the priority");
+    }
+    else if (thread_get(test_thread)->priority != owner_prio) {
+        puts("error: owner kept the inherited priority");
+    }
+    else {
+        puts("OK");
+    }
+
+    /* to end the created thread */
+    msg_t msg;
+    thread_wakeup(test_thread);
+    puts("MAIN THREAD: waiting for created thread to end");
+    msg_receive(&msg);
+
+    /* to make the test easier to read */
+    printf("\n");
+
+    return 0;
+}
+
 /**
  * @brief   shell command to test xtimer_mutex_lock_timeout when spinning
  *
@@ -41,6 +41,14 @@ def testfunc(child):
     child.expect(r"threads = (\d+)\r\n")
     assert int(child.match.group(1)) == num_threads
     child.expect_exact("> ")
+    child.sendline("mutex_timeout_long_locked_low_owner")
+    child.expect_exact("starting test: xtimer mutex lock timeout with low prio owner")
+    child.expect_exact("THREAD low prio: start")
+    child.expect_exact("MAIN THREAD: calling xtimer_mutex_lock_timeout")
+    child.expect_exact("OK")
+    child.expect_exact("MAIN THREAD: waiting for created thread to end")
+    child.expect_exact("THREAD low prio: exiting low")
+    child.expect_exact("> ")
     child.sendline("mutex_timeout_short_locked")
     child.expect_exact("starting test: xtimer mutex lock timeout with short timeout and locked mutex")
     child.expect_exact("OK")
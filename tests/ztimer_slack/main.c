@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the wakeups saved by ztimer_set_with_slack()
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "timex.h"
+#include "ztimer.h"
+#include "ztimer/overhead.h"
+
+#ifndef TEST_TIMERS
+#define TEST_TIMERS         (8U)
+#endif
+
+#ifndef TEST_PERIOD
+#define TEST_PERIOD         (10U * US_PER_MS)
+#endif
+
+#ifndef TEST_PERIOD_STEP
+#define TEST_PERIOD_STEP    (1100U)
+#endif
+
+#ifndef TEST_SLACK
+#define TEST_SLACK          (5U * US_PER_MS)
+#endif
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1U * US_PER_SEC)
+#endif
+
+static ztimer_t _timers[TEST_TIMERS];
+static uint32_t _slack;
+
+static void _cb(void *arg)
+{
+    ztimer_t *timer = arg;
+    unsigned idx = timer - _timers;
+
+    ztimer_set_with_slack(ZTIMER_USEC, timer,
+                          TEST_PERIOD + idx * TEST_PERIOD_STEP, _slack);
+}
+
+static uint32_t _measure(uint32_t slack)
+{
+    _slack = slack;
+    for (unsigned i = 0; i < TEST_TIMERS; i++) {
+        _timers[i].callback = _cb;
+        _timers[i].arg = &_timers[i];
+        _cb(&_timers[i]);
+    }
+
+    uint32_t wakeups = ztimer_overhead_wakeups(ZTIMER_USEC, TEST_DURATION);
+
+    for (unsigned i = 0; i < TEST_TIMERS; i++) {
+        ztimer_remove(ZTIMER_USEC, &_timers[i]);
+    }
+
+    return (uint64_t)wakeups * US_PER_SEC / TEST_DURATION;
+}
+
+int main(void)
+{
+    uint32_t exact = _measure(0);
+    uint32_t slack = _measure(TEST_SLACK);
+
+    printf("{ \"wakeups_per_sec\" : %" PRIu32 ", "
+           "\"slack_wakeups_per_sec\" : %" PRIu32 ", "
+           "\"saved_per_sec\" : %" PRIi32 " }\n",
+           exact, slack, (int32_t)(exact - slack));
+
+    return 0;
+}
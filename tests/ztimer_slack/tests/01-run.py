@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 OTA keys S.A.
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"{ \"wakeups_per_sec\" : (\d+), "
+                 r"\"slack_wakeups_per_sec\" : (\d+), "
+                 r"\"saved_per_sec\" : (-?\d+) }")
+    exact = int(child.match.group(1))
+    slack = int(child.match.group(2))
+    assert slack < exact, "no wakeups saved"
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Runs the ztimer unittests and the timing wheel's tests with the
+ *              timing wheel
+ *
+ * @}
+ */
+
+#include "embUnit.h"
+
+#include "tests-ztimer.h"
+
+Test *tests_ztimer_wheel_tests(void);
+
+int main(void)
+{
+    TESTS_START();
+    tests_ztimer();
+    TESTS_RUN(tests_ztimer_wheel_tests());
+    TESTS_END();
+
+    return 0;
+}
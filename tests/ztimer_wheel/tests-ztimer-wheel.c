@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2026 OTA keys S.A.
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ztimer timing wheel
+ *
+ * The tests assume the default wheel configuration, i.e. 1024 ticks wide
+ * level 0 slots and three levels spanning 2^25 ticks.
+ */
+
+#include "kernel_defines.h"
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+#define TIMERS_NUMOF    (9U)
+
+static ztimer_mock_t zmock;
+static ztimer_t timers[TIMERS_NUMOF];
+static uint32_t fired_at[TIMERS_NUMOF];
+static unsigned order[TIMERS_NUMOF];
+static unsigned fired;
+
+static void cb_record(void *arg)
+{
+    unsigned i = (ztimer_t *)arg - timers;
+
+    fired_at[i] = ztimer_now(&zmock.super);
+    order[fired++] = i;
+}
+
+static void set_up(void)
+{
+    ztimer_mock_init(&zmock, 32);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        timers[i] = (ztimer_t){ .callback = cb_record, .arg = &timers[i] };
+        fired_at[i] = 0;
+    }
+    fired = 0;
+}
+
+/*
+ * Sets timers in the list, on every wheel level and beyond the top level in
+ * random order, some of them sharing a slot.
+ * Expected result: all timers fire in the order of their targets, each one
+ * exactly at its target
+ */
+static void test_ztimer_wheel_order(void)
+{
+    static const uint32_t targets[TIMERS_NUMOF] = {
+        40000, 4900, 700, 4200, 100000000, 2000000, 1500, 33000, 4500
+    };
+    static const unsigned expected[TIMERS_NUMOF] = { 2, 6, 3, 8, 1, 7, 0, 5, 4 };
+    ztimer_clock_t *z = &zmock.super;
+
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        ztimer_set(z, &timers[i], targets[i]);
+    }
+    ztimer_mock_advance(&zmock, 100000000);
+    TEST_ASSERT_EQUAL_INT(TIMERS_NUMOF, fired);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(expected[i], order[i]);
+        TEST_ASSERT_EQUAL_INT(targets[i], fired_at[i]);
+    }
+}
+
+/*
+ * Sets a timer on the top level and follows it down to the list.
+ * Expected result: the timer moves one level down whenever the slot it is in
+ * is processed, ends up in the list less than one slot before its target and
+ * fires exactly at its target
+ */
+static void test_ztimer_wheel_cascade(void)
+{
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_wheel_t *wheel = &z->wheel;
+
+    ztimer_set(z, &timers[0], 3000000);
+    TEST_ASSERT_EQUAL_INT(0, wheel->bitmap[0]);
+    TEST_ASSERT_EQUAL_INT(0, wheel->bitmap[1]);
+    TEST_ASSERT_EQUAL_INT(1UL << 2, wheel->bitmap[2]);
+    /* start of level 2 slot 2 */
+    ztimer_mock_advance(&zmock, 2 << 20);
+    TEST_ASSERT_EQUAL_INT(0, wheel->bitmap[0]);
+    TEST_ASSERT_EQUAL_INT(1UL << (91 & 31), wheel->bitmap[1]);
+    TEST_ASSERT_EQUAL_INT(0, wheel->bitmap[2]);
+    /* start of level 1 slot 91 */
+    ztimer_mock_advance(&zmock, (91 << 15) - (2 << 20));
+    TEST_ASSERT_EQUAL_INT(1UL << (2929 & 31), wheel->bitmap[0]);
+    TEST_ASSERT_EQUAL_INT(0, wheel->bitmap[1]);
+    TEST_ASSERT_EQUAL_INT(0, wheel->bitmap[2]);
+    /* start of level 0 slot 2929 */
+    ztimer_mock_advance(&zmock, (2929 << 10) - (91 << 15));
+    TEST_ASSERT_EQUAL_INT(0, wheel->bitmap[0]);
+    TEST_ASSERT_EQUAL_INT(0, wheel->bitmap[1]);
+    TEST_ASSERT_EQUAL_INT(0, wheel->bitmap[2]);
+    TEST_ASSERT(z->list.next == &timers[0].base);
+    ztimer_mock_advance(&zmock, 3000000 - (2929 << 10) - 1);
+    TEST_ASSERT_EQUAL_INT(0, fired);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, fired);
+    TEST_ASSERT_EQUAL_INT(3000000, fired_at[0]);
+}
+
+/*
+ * Sets three timers due at the same time on the top level, a fourth one with
+ * the same target once they moved down a level and a fifth one less than a
+ * slot before the target, before the level 0 slot they are in is processed.
+ * Expected result: the timers fire in the order they were set, all exactly at
+ * their target
+ */
+static void test_ztimer_wheel_same_target(void)
+{
+    ztimer_clock_t *z = &zmock.super;
+    const uint32_t target = 3000000;
+
+    for (unsigned i = 0; i < 3; i++) {
+        ztimer_set(z, &timers[i], target);
+    }
+    TEST_ASSERT_EQUAL_INT(1UL << 2, z->wheel.bitmap[2]);
+    /* start of level 2 slot 2 */
+    ztimer_mock_advance(&zmock, 2 << 20);
+    TEST_ASSERT_EQUAL_INT(0, z->wheel.bitmap[2]);
+    ztimer_set(z, &timers[3], target - (2 << 20));
+    /* 296 ticks before the start of level 0 slot 2929 */
+    ztimer_mock_advance(&zmock, 2999000 - (2 << 20));
+    ztimer_set(z, &timers[4], target - 2999000);
+    ztimer_mock_advance(&zmock, target - 2999000);
+    TEST_ASSERT_EQUAL_INT(5, fired);
+    for (unsigned i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL_INT(i, order[i]);
+        TEST_ASSERT_EQUAL_INT(target, fired_at[i]);
+    }
+}
+
+/*
+ * Sets three timers into the same slot, a fourth one alone into another slot
+ * and a fifth one into the list, then removes the middle and the last timer of
+ * the shared slot's list, the single timer and the one in the list.
+ * Expected result: only the remaining timer fires, the emptied slots are
+ * marked as such and the wheel's internal timer is not left behind
+ */
+static void test_ztimer_wheel_remove(void)
+{
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_wheel_t *wheel = &z->wheel;
+
+    ztimer_set(z, &timers[0], 4200);
+    ztimer_set(z, &timers[1], 4500);
+    ztimer_set(z, &timers[2], 4900);
+    ztimer_set(z, &timers[3], 20000);
+    ztimer_set(z, &timers[4], 500);
+    TEST_ASSERT_EQUAL_INT((1UL << 4) | (1UL << 19), wheel->bitmap[0]);
+    ztimer_remove(z, &timers[1]);
+    ztimer_remove(z, &timers[2]);
+    TEST_ASSERT_EQUAL_INT((1UL << 4) | (1UL << 19), wheel->bitmap[0]);
+    TEST_ASSERT(wheel->slots[0][4] == &timers[0].base);
+    ztimer_remove(z, &timers[3]);
+    TEST_ASSERT_EQUAL_INT(1UL << 4, wheel->bitmap[0]);
+    ztimer_remove(z, &timers[4]);
+    TEST_ASSERT_EQUAL_INT(1UL << 4, wheel->bitmap[0]);
+    ztimer_mock_advance(&zmock, 30000);
+    TEST_ASSERT_EQUAL_INT(1, fired);
+    TEST_ASSERT_EQUAL_INT(0, order[0]);
+    TEST_ASSERT_EQUAL_INT(4200, fired_at[0]);
+    TEST_ASSERT_EQUAL_INT(0, wheel->bitmap[0]);
+    TEST_ASSERT(!wheel->armed);
+    TEST_ASSERT_NULL(z->list.next);
+
+    /* removing the last timer of the wheel disarms its internal timer */
+    ztimer_set(z, &timers[1], 50000);
+    TEST_ASSERT(wheel->armed);
+    ztimer_remove(z, &timers[1]);
+    TEST_ASSERT(!wheel->armed);
+    TEST_ASSERT_NULL(z->list.next);
+    ztimer_mock_advance(&zmock, 50000);
+    TEST_ASSERT_EQUAL_INT(1, fired);
+}
+
+/*
+ * Sets two timers beyond the span of the top level that map to the same top
+ * level slot, one round apart.
+ * Expected result: each timer stays in the wheel until its own round and
+ * fires exactly at its target
+ */
+static void test_ztimer_wheel_beyond_top(void)
+{
+    ztimer_clock_t *z = &zmock.super;
+    const uint32_t span = 1UL << 25;
+
+    ztimer_set(z, &timers[0], 3 * span + 5000);
+    ztimer_set(z, &timers[1], 4 * span + 5000);
+    ztimer_mock_advance(&zmock, 3 * span + 4999);
+    TEST_ASSERT_EQUAL_INT(0, fired);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, fired);
+    TEST_ASSERT_EQUAL_INT(3 * span + 5000, fired_at[0]);
+    ztimer_mock_advance(&zmock, span - 1);
+    TEST_ASSERT_EQUAL_INT(1, fired);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(2, fired);
+    TEST_ASSERT_EQUAL_INT(4 * span + 5000, fired_at[1]);
+}
+
+/*
+ * Sets a timer due immediately while the wheel is in use, then lets the
+ * clock pass two wheel timers' targets before its interrupt is handled.
+ * Expected result: the immediate timer fires right away, the late ones fire
+ * in order as soon as the interrupt is handled
+ */
+static void test_ztimer_wheel_past(void)
+{
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_set(z, &timers[0], 5000);
+    ztimer_set(z, &timers[1], 6000);
+    ztimer_set(z, &timers[2], 0);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, fired);
+    TEST_ASSERT_EQUAL_INT(2, order[0]);
+    TEST_ASSERT_EQUAL_INT(0, fired_at[2]);
+
+    /* the interrupt of the wheel's timer is handled late */
+    ztimer_mock_jump(&zmock, 8000);
+    ztimer_mock_fire(&zmock);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(3, fired);
+    TEST_ASSERT_EQUAL_INT(0, order[1]);
+    TEST_ASSERT_EQUAL_INT(1, order[2]);
+    TEST_ASSERT_NULL(z->list.next);
+}
+
+/*
+ * Sets timers from shortly before the 32 bit counter wraps to after it,
+ * landing on all levels.
+ * Expected result: all timers fire in order, each one exactly at its target
+ */
+static void test_ztimer_wheel_wrap(void)
+{
+    static const uint32_t vals[] = { 0x2000000, 0x20000, 0x1000, 0x300000 };
+    static const unsigned expected[] = { 2, 1, 3, 0 };
+    ztimer_clock_t *z = &zmock.super;
+    const uint32_t start = 0xffff0123;
+
+    ztimer_mock_jump(&zmock, start);
+    for (unsigned i = 0; i < ARRAY_SIZE(vals); i++) {
+        ztimer_set(z, &timers[i], vals[i]);
+    }
+    ztimer_mock_advance(&zmock, 0x2000000);
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(vals), fired);
+    for (unsigned i = 0; i < ARRAY_SIZE(vals); i++) {
+        TEST_ASSERT_EQUAL_INT(expected[i], order[i]);
+        TEST_ASSERT_EQUAL_INT(start + vals[i], fired_at[i]);
+    }
+}
+
+Test *tests_ztimer_wheel_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_wheel_order),
+        new_TestFixture(test_ztimer_wheel_cascade),
+        new_TestFixture(test_ztimer_wheel_same_target),
+        new_TestFixture(test_ztimer_wheel_remove),
+        new_TestFixture(test_ztimer_wheel_beyond_top),
+        new_TestFixture(test_ztimer_wheel_past),
+        new_TestFixture(test_ztimer_wheel_wrap),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_wheel_tests, set_up, NULL, fixtures);
+
+    return (Test *)&ztimer_wheel_tests;
+}
+
+/** @} */